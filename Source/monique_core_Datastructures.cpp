@@ -632,10 +632,91 @@ static inline void collect_saveable_parameters(ChorusData *data_,
     params_.add(&data_->pan);
 }
 
+//==============================================================================
+COLD mono_ParameterSnapshot::mono_ParameterSnapshot() noexcept
+    : front(nullptr), back(nullptr), size(0), next_value_offset(0), num_free_value_slots(0)
+{
+}
+COLD mono_ParameterSnapshot::~mono_ParameterSnapshot() noexcept {}
+
+//==============================================================================
+COLD int mono_ParameterSnapshot::add_region(const float *source_, int size_) noexcept
+{
+    // EVERY REGION STARTS AT A CACHE LINE
+    const int offset = size;
+    size += (size_ + 15) & ~15;
+    regions.add({source_, offset, size_});
+    regions.minimiseStorageOverheads();
+
+    reallocate();
+
+    return offset;
+}
+COLD int mono_ParameterSnapshot::add_value(const float *source_) noexcept
+{
+    // THE VALUES SHARE CACHE LINES
+    if (num_free_value_slots == 0)
+    {
+        next_value_offset = size;
+        size += 16;
+        num_free_value_slots = 16;
+    }
+    const int offset = next_value_offset++;
+    --num_free_value_slots;
+    values.add({source_, offset});
+    values.minimiseStorageOverheads();
+
+    reallocate();
+
+    return offset;
+}
+COLD void mono_ParameterSnapshot::reallocate() noexcept
+{
+    memory.allocate(size_t(size) * 2 * sizeof(float) + 64, true);
+    front = reinterpret_cast<float *>((reinterpret_cast<pointer_sized_int>(memory.getData()) + 63) &
+                                      ~pointer_sized_int(63));
+    back = front + size;
+    copy_to(front);
+}
+inline void mono_ParameterSnapshot::copy_to(float *dest_) const noexcept
+{
+    for (int i = 0; i != regions.size(); ++i)
+    {
+        const Region &region = regions.getReference(i);
+        FloatVectorOperations::copy(dest_ + region.offset, region.source, region.size);
+    }
+    for (int i = 0; i != values.size(); ++i)
+    {
+        const Value &value = values.getReference(i);
+        dest_[value.offset] = *value.source;
+    }
+}
+bool mono_ParameterSnapshot::update() noexcept
+{
+    // THE VALUES CHANGE WITHOUT A WRITE SCOPE (KNOBS, AUTOMATION), SO THERE IS A COPY EVERY BLOCK
+    unsigned int version;
+    if (not guard.begin_read(version))
+    {
+        return false;
+    }
+
+    copy_to(back);
+    if (not guard.end_read(version))
+    {
+        return false;
+    }
+
+    std::swap(front, back);
+    return true;
+}
+
 //==============================================================================
 COLD MorphGroup::MorphGroup() noexcept
-    : left_morph_source(nullptr), right_morph_source(nullptr), last_power_of_right(0),
-      current_switch(LEFT), current_callbacks(-1)
+    : last_power_of_right(0), current_switch(LEFT), snapshot(nullptr), left_values_offset(0),
+      right_values_offset(0), left_modulations_offset(0), right_modulations_offset(0),
+      power_of_right_offset(0), num_sync_morph_requests(0), num_sync_morph_requests_done(0),
+      num_sync_morph_blocks(0), current_sync_morph_request(0), last_num_sync_morph_blocks(0),
+      last_sync_morph_block_ms(0), sync_morph_samples(1), sync_morph_samples_left(0)
 {
 }
 
@@ -675,158 +756,328 @@ COLD void MorphGroup::register_switch_parameter(IntParameter *param_, bool is_ma
         param_->register_listener(this);
     }
 }
-COLD void MorphGroup::set_sources(MorphGroup *left_source_, MorphGroup *right_source_,
-                                  float current_morph_amount_, bool current_switch_state_) noexcept
+COLD void MorphGroup::init_sources(float current_morph_amount_, bool current_switch_state_,
+                                   mono_ParameterSnapshot *snapshot_) noexcept
 {
     last_power_of_right = current_morph_amount_;
     current_switch = current_switch_state_;
 
-    left_morph_source = left_source_;
-    right_morph_source = right_source_;
-}
-
-//==============================================================================
-void MorphGroup::morph(float power_of_right_) noexcept
-{
-    for (int i = 0; i != params.size(); ++i)
+    for (int side = LEFT; side <= RIGHT; ++side)
     {
-        Parameter *target_param = params.getUnchecked(i);
-        const Parameter *left_param = left_morph_source->params.getUnchecked(i);
-        const Parameter *right_param = right_morph_source->params.getUnchecked(i);
+        Source &source = get_source(side);
+        source.values.clearQuick();
+        source.modulation_amounts.clearQuick();
+        for (int i = 0; i != params.size(); ++i)
+        {
+            const Parameter *param = params.getUnchecked(i);
+            source.values.add(param->get_value());
+            source.modulation_amounts.add(param->get_modulation_amount());
+        }
+        source.bool_switches.clearQuick();
+        for (int i = 0; i != switch_bool_params.size(); ++i)
+        {
+            source.bool_switches.add(switch_bool_params.getUnchecked(i)->get_value() != 0);
+        }
+        source.int_switches.clearQuick();
+        for (int i = 0; i != switch_int_params.size(); ++i)
+        {
+            source.int_switches.add(int(switch_int_params.getUnchecked(i)->get_value()));
+        }
 
-        // VALUE
-        const float new_value = (left_param->get_value() * (1.0f - power_of_right_)) +
-                                (right_param->get_value() * power_of_right_);
-        target_param->set_value_without_notification(new_value);
+        source.values.minimiseStorageOverheads();
+        source.modulation_amounts.minimiseStorageOverheads();
+        source.bool_switches.minimiseStorageOverheads();
+        source.int_switches.minimiseStorageOverheads();
+    }
+    morph_buffer.allocate(jmax(1, params.size()), true);
+    sync_start_values.allocate(jmax(1, params.size()), true);
+    sync_start_modulations.allocate(jmax(1, params.size()), true);
+    sync_values.allocate(jmax(1, params.size()), true);
+    sync_modulations.allocate(jmax(1, params.size()), true);
 
-        // MODULATION VALUE
-        if (has_modulation(target_param))
+    snapshot = snapshot_;
+    left_values_offset =
+        snapshot->add_region(left_source.values.getRawDataPointer(), params.size());
+    right_values_offset =
+        snapshot->add_region(right_source.values.getRawDataPointer(), params.size());
+    left_modulations_offset =
+        snapshot->add_region(left_source.modulation_amounts.getRawDataPointer(), params.size());
+    right_modulations_offset =
+        snapshot->add_region(right_source.modulation_amounts.getRawDataPointer(), params.size());
+    power_of_right_offset = snapshot->add_region(&last_power_of_right, 1);
+
+    // ONLY THE MASTER PARAMS HAVE SMOOTHERS
+    smoothed_params.clearQuick();
+    for (int i = 0; i != params.size(); ++i)
+    {
+        if (SmoothedParameter *smoother = params.getUnchecked(i)->get_runtime_info().my_smoother)
         {
-            const float target_modulation =
-                (left_param->get_modulation_amount() * (1.0f - power_of_right_)) +
-                (right_param->get_modulation_amount() * power_of_right_);
-            target_param->set_modulation_amount_without_notification(target_modulation);
+            smoothed_params.add({smoother, i});
         }
     }
-    last_power_of_right = power_of_right_;
+    smoothed_params.minimiseStorageOverheads();
 }
-void MorphGroup::morph_switchs(bool left_right_) noexcept
+
+//==============================================================================
+void MorphGroup::set_source_from_current(bool left_or_right_) noexcept
 {
-    current_switch = left_right_;
+    const mono_VersionGuard::ScopedWrite write(snapshot->guard);
+    Source &source = get_source(left_or_right_);
+    for (int i = 0; i != params.size(); ++i)
+    {
+        const Parameter *param = params.getUnchecked(i);
+        source.values.setUnchecked(i, param->get_value());
+        source.modulation_amounts.setUnchecked(i, param->get_modulation_amount());
+    }
     for (int i = 0; i != switch_bool_params.size(); ++i)
     {
-        if (current_switch == RIGHT)
+        source.bool_switches.setUnchecked(i, switch_bool_params.getUnchecked(i)->get_value() != 0);
+    }
+    for (int i = 0; i != switch_int_params.size(); ++i)
+    {
+        source.int_switches.setUnchecked(i, int(switch_int_params.getUnchecked(i)->get_value()));
+    }
+}
+// SAME FORMAT AS write_parameter_to_file AND read_parameter_from_file, ONLY FOR THE GROUP PARAMS
+void MorphGroup::save_source_to(bool left_or_right_, XmlElement &xml_) const noexcept
+{
+    const Source &source = left_or_right_ == RIGHT ? right_source : left_source;
+    for (int i = 0; i != params.size(); ++i)
+    {
+        const Parameter *param = params.getUnchecked(i);
+        const ParameterInfo &info = param->get_info();
+        const float value = source.values.getUnchecked(i);
+        if (value != info.init_value)
         {
-            switch_bool_params[i]->set_value_without_notification(
-                right_morph_source->switch_bool_params[i]->get_value());
+            xml_.setAttribute(info.name, value);
         }
-        else
+
+        if (has_modulation(param))
         {
-            switch_bool_params[i]->set_value_without_notification(
-                left_morph_source->switch_bool_params[i]->get_value());
+            const float modulation_amount = source.modulation_amounts.getUnchecked(i);
+            if (modulation_amount != info.init_modulation_amount)
+            {
+                xml_.setAttribute(info.name + String("_mod"), modulation_amount);
+            }
         }
     }
-    for (int i = 0; i != switch_int_params.size(); ++i)
+    for (int i = 0; i != switch_bool_params.size(); ++i)
     {
-        if (current_switch == RIGHT)
+        const ParameterInfo &info = switch_bool_params.getUnchecked(i)->get_info();
+        const float value = source.bool_switches.getUnchecked(i) ? 1 : 0;
+        if (value != info.init_value)
         {
-            switch_int_params[i]->set_value_without_notification(
-                right_morph_source->switch_int_params[i]->get_value());
+            xml_.setAttribute(info.name, value);
         }
-        else
+    }
+    for (int i = 0; i != switch_int_params.size(); ++i)
+    {
+        const ParameterInfo &info = switch_int_params.getUnchecked(i)->get_info();
+        const float value = source.int_switches.getUnchecked(i);
+        if (value != info.init_value)
         {
-            switch_int_params[i]->set_value_without_notification(
-                left_morph_source->switch_int_params[i]->get_value());
+            xml_.setAttribute(info.name, value);
         }
     }
 }
-#define SYNC_MORPH_STEPS 100
-#define SYNC_MORPH_TIME 10
-void MorphGroup::run_sync_morph() noexcept
+void MorphGroup::read_source_from(bool left_or_right_, const XmlElement &xml_) noexcept
 {
-    stopTimer();
-    current_callbacks = 0;
-
-    sync_param_deltas.clearQuick();
-    sync_modulation_deltas.clearQuick();
+    const mono_VersionGuard::ScopedWrite write(snapshot->guard);
+    Source &source = get_source(left_or_right_);
     for (int i = 0; i != params.size(); ++i)
     {
-        Parameter *target_param = params.getUnchecked(i);
-        const Parameter *left_param = left_morph_source->params.getUnchecked(i);
-        const Parameter *right_param = right_morph_source->params.getUnchecked(i);
+        const Parameter *param = params.getUnchecked(i);
+        const ParameterInfo &info = param->get_info();
+        source.values.setUnchecked(
+            i, jlimit(info.min_value, info.max_value,
+                      float(xml_.getDoubleAttribute(info.name, info.init_value))));
 
-        // VALUE
+        if (has_modulation(param))
         {
-            // bei 0.5 = (l + r)/2
-            const float target_value = (left_param->get_value() * (1.0f - last_power_of_right)) +
-                                       (right_param->get_value() * last_power_of_right);
-            const float current_value = target_param->get_value();
-            sync_param_deltas.add((target_value - current_value) / SYNC_MORPH_STEPS);
+            source.modulation_amounts.setUnchecked(
+                i, float(xml_.getDoubleAttribute(info.name + String("_mod"),
+                                                 info.init_modulation_amount)));
         }
+    }
+    for (int i = 0; i != switch_bool_params.size(); ++i)
+    {
+        const ParameterInfo &info = switch_bool_params.getUnchecked(i)->get_info();
+        source.bool_switches.setUnchecked(i,
+                                          xml_.getDoubleAttribute(info.name, info.init_value) != 0);
+    }
+    for (int i = 0; i != switch_int_params.size(); ++i)
+    {
+        const ParameterInfo &info = switch_int_params.getUnchecked(i)->get_info();
+        source.int_switches.setUnchecked(
+            i, roundToInt(jlimit(info.min_value, info.max_value,
+                                 float(xml_.getDoubleAttribute(info.name, info.init_value)))));
+    }
+}
 
-        // MODULATION
+//==============================================================================
+void MorphGroup::morph(float power_of_right_) noexcept
+{
+    const mono_VersionGuard::ScopedWrite write(snapshot->guard);
+    const int num_params = params.size();
+    float *const morphed = morph_buffer.getData();
+
+    // VALUE
+    FloatVectorOperations::copyWithMultiply(morphed, left_source.values.getRawDataPointer(),
+                                            1.0f - power_of_right_, num_params);
+    FloatVectorOperations::addWithMultiply(morphed, right_source.values.getRawDataPointer(),
+                                           power_of_right_, num_params);
+    for (int i = 0; i != num_params; ++i)
+    {
+        params.getUnchecked(i)->set_value_without_notification(morphed[i]);
+    }
+
+    // MODULATION VALUE
+    FloatVectorOperations::copyWithMultiply(morphed,
+                                            left_source.modulation_amounts.getRawDataPointer(),
+                                            1.0f - power_of_right_, num_params);
+    FloatVectorOperations::addWithMultiply(morphed,
+                                           right_source.modulation_amounts.getRawDataPointer(),
+                                           power_of_right_, num_params);
+    for (int i = 0; i != num_params; ++i)
+    {
+        Parameter *target_param = params.getUnchecked(i);
         if (has_modulation(target_param))
         {
-            const float target_modulation =
-                (left_param->get_modulation_amount() * (1.0f - last_power_of_right)) +
-                (right_param->get_modulation_amount() * last_power_of_right);
-            const float current_modulation = target_param->get_modulation_amount();
-            sync_modulation_deltas.add((target_modulation - current_modulation) / SYNC_MORPH_STEPS);
+            target_param->set_modulation_amount_without_notification(morphed[i]);
         }
-        else
+    }
+    last_power_of_right = power_of_right_;
+}
+void MorphGroup::morph_switchs(bool left_right_) noexcept
+{
+    current_switch = left_right_;
+    const Source &source = get_source(current_switch);
+    for (int i = 0; i != switch_bool_params.size(); ++i)
+    {
+        switch_bool_params[i]->set_value_without_notification(source.bool_switches[i]);
+    }
+    for (int i = 0; i != switch_int_params.size(); ++i)
+    {
+        switch_int_params[i]->set_value_without_notification(source.int_switches[i]);
+    }
+}
+void MorphGroup::run_sync_morph() noexcept
+{
+    num_sync_morph_requests.fetch_add(1, std::memory_order_release);
+    last_num_sync_morph_blocks = num_sync_morph_blocks.load(std::memory_order_relaxed);
+    last_sync_morph_block_ms = Time::getMillisecondCounter();
+    if (not isTimerRunning())
+    {
+        startTimer(PARAM_CHANGE_INTERVAL_IN_MS);
+    }
+}
+bool MorphGroup::process_sync_morph(const float *snapshot_, int num_samples_,
+                                    double sample_rate_) noexcept
+{
+    const int num_params = smoothed_params.size();
+    const int request = num_sync_morph_requests.load(std::memory_order_acquire);
+    if (request != current_sync_morph_request)
+    {
+        // A NEW REQUEST STARTS OVER FROM WHERE THE SMOOTHERS GO NOW, THE PARAMS ARE STILL WHERE
+        // THE LAST FINISHED SYNC MORPH HAS LEFT THEM
+        const bool is_running = sync_morph_samples_left > 0;
+        for (int i = 0; i != num_params; ++i)
         {
-            sync_modulation_deltas.add(-1);
+            const SmoothedMorphParameter &param = smoothed_params.getReference(i);
+            sync_start_values[param.index] =
+                is_running ? sync_values[param.index] : snapshot_[param.smoother->value_offset];
+            sync_start_modulations[param.index] =
+                is_running ? sync_modulations[param.index]
+                           : snapshot_[param.smoother->modulation_offset];
         }
+        current_sync_morph_request = request;
+        sync_morph_samples = jmax(1, msToSamplesFast(SYNC_MORPH_TIME_IN_MS, sample_rate_));
+        sync_morph_samples_left = sync_morph_samples;
     }
 
-    startTimer(SYNC_MORPH_TIME);
-}
-void MorphGroup::timerCallback()
-{
-    for (int i = 0; i != params.size(); ++i)
+    if (sync_morph_samples_left <= 0)
+    {
+        return false;
+    }
+    num_sync_morph_blocks.fetch_add(1, std::memory_order_relaxed);
+
+    // THE TARGET FOLLOWS THE SNAPSHOT, THE LAST BLOCK ENDS EXACTLY ON IT
+    sync_morph_samples_left = jmax(0, sync_morph_samples_left - num_samples_);
+    const float power_of_start = float(sync_morph_samples_left) / sync_morph_samples;
+    const float *const left_values = snapshot_ + left_values_offset;
+    const float *const right_values = snapshot_ + right_values_offset;
+    const float *const left_modulations = snapshot_ + left_modulations_offset;
+    const float *const right_modulations = snapshot_ + right_modulations_offset;
+    const float power_of_right = snapshot_[power_of_right_offset];
+    for (int i = 0; i != num_params; ++i)
     {
-        Parameter *param = params.getUnchecked(i);
+        const SmoothedMorphParameter &param = smoothed_params.getReference(i);
+        const int index = param.index;
 
         // VALUE
         {
-            const ParameterInfo &info = param->get_info();
-            const float min = info.min_value;
-            const float max = info.max_value;
-            float new_value = param->get_value() + sync_param_deltas[i];
-            if (new_value > max)
-            {
-                new_value = max;
-            }
-            else if (new_value < min)
-            {
-                new_value = min;
-            }
-
-            param->set_value_without_notification(new_value);
+            const float target_value = left_values[index] * (1.0f - power_of_right) +
+                                       right_values[index] * power_of_right;
+            const float new_value =
+                target_value + (sync_start_values[index] - target_value) * power_of_start;
+            sync_values[index] = jlimit(param.smoother->min_value, param.smoother->max_value,
+                                        new_value);
         }
 
         // MODULATION
-        const float modulation_delta = sync_modulation_deltas[i];
-        if (modulation_delta != -1)
         {
-            float new_modualtation = param->get_modulation_amount() + modulation_delta;
-            if (new_modualtation > 1)
-            {
-                new_modualtation = 1;
-            }
-            else if (new_modualtation < -1)
-            {
-                new_modualtation = -1;
-            }
-
-            param->set_modulation_amount_without_notification(new_modualtation);
+            const float target_modulation = left_modulations[index] * (1.0f - power_of_right) +
+                                            right_modulations[index] * power_of_right;
+            const float new_modulation =
+                target_modulation +
+                (sync_start_modulations[index] - target_modulation) * power_of_start;
+            sync_modulations[index] = jlimit(-1.0f, 1.0f, new_modulation);
         }
     }
 
-    if (current_callbacks++ == SYNC_MORPH_STEPS)
+    if (sync_morph_samples_left == 0)
+    {
+        num_sync_morph_requests_done.store(current_sync_morph_request, std::memory_order_release);
+    }
+
+    return true;
+}
+bool MorphGroup::finish_sync_morph() noexcept
+{
+    if (num_sync_morph_requests_done.load(std::memory_order_acquire) !=
+        num_sync_morph_requests.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    stopTimer();
+    morph(last_power_of_right);
+    return true;
+}
+bool MorphGroup::finish_stalled_sync_morph(uint32 now_ms_) noexcept
+{
+    const int num_blocks = num_sync_morph_blocks.load(std::memory_order_relaxed);
+    if (num_blocks != last_num_sync_morph_blocks)
+    {
+        last_num_sync_morph_blocks = num_blocks;
+        last_sync_morph_block_ms = now_ms_;
+        return false;
+    }
+    if (now_ms_ - last_sync_morph_block_ms < SYNC_MORPH_TIMEOUT_IN_MS)
+    {
+        return false;
+    }
+
+    // A LATER BLOCK FINISHES THE RAMP OF THE SMOOTHERS FROM THESE VALUES
+    stopTimer();
+    morph(last_power_of_right);
+    return true;
+}
+void MorphGroup::timerCallback()
+{
+    if (not finish_sync_morph())
     {
-        stopTimer();
-        morph(last_power_of_right);
+        finish_stalled_sync_morph(Time::getMillisecondCounter());
     }
 }
 
@@ -841,15 +1092,14 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
         const int param_id = switch_bool_params.indexOf(reinterpret_cast<BoolParameter *>(param_));
         if (param_id != -1)
         {
-            if (current_switch == RIGHT)
+            // SOME SWITCHES ARE REGISTERED TWICE
+            Source &source = get_source(current_switch);
+            for (int i = param_id; i != switch_bool_params.size(); ++i)
             {
-                right_morph_source->switch_bool_params[param_id]->set_value_without_notification(
-                    param_->get_value());
-            }
-            else
-            {
-                left_morph_source->switch_bool_params[param_id]->set_value_without_notification(
-                    param_->get_value());
+                if (switch_bool_params.getUnchecked(i) == param_)
+                {
+                    source.bool_switches.setUnchecked(i, param_->get_value() != 0);
+                }
             }
         }
 #ifdef JUCE_DEBUG
@@ -865,15 +1115,13 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
         const int param_id = switch_int_params.indexOf(reinterpret_cast<IntParameter *>(param_));
         if (param_id != -1)
         {
-            if (current_switch == RIGHT)
-            {
-                right_morph_source->switch_int_params[param_id]->set_value_without_notification(
-                    param_->get_value());
-            }
-            else
+            Source &source = get_source(current_switch);
+            for (int i = param_id; i != switch_int_params.size(); ++i)
             {
-                left_morph_source->switch_int_params[param_id]->set_value_without_notification(
-                    param_->get_value());
+                if (switch_int_params.getUnchecked(i) == param_)
+                {
+                    source.int_switches.setUnchecked(i, int(param_->get_value()));
+                }
             }
         }
 #ifdef JUCE_DEBUG
@@ -889,8 +1137,9 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
         const int param_id = params.indexOf(param_);
         if (param_id != -1)
         {
-            Parameter *const left_source_param = left_morph_source->params[param_id];
-            Parameter *const right_source_param = right_morph_source->params[param_id];
+            const mono_VersionGuard::ScopedWrite write(snapshot->guard);
+            float &left_source_value = left_source.values.getReference(param_id);
+            float &right_source_value = right_source.values.getReference(param_id);
 
             const double right_power = last_power_of_right;
             const double left_power = 1.0f - right_power;
@@ -898,12 +1147,12 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
             // KEEP THE RIGHT SIDE UNTOUCHED
             if (left_power == 1)
             {
-                left_source_param->set_value_without_notification(param_->get_value());
+                left_source_value = param_->get_value();
             }
             // KEEP THE LEFT SIDE UNTOUCHED
             else if (right_power == 1)
             {
-                right_source_param->set_value_without_notification(param_->get_value());
+                right_source_value = param_->get_value();
             }
             else
             {
@@ -927,8 +1176,8 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
                 // (right_power/left_power)*right_value
 
                 const float current_value = param_->get_value();
-                const float right_value = right_source_param->get_value();
-                const float left_value = left_source_param->get_value();
+                const float right_value = right_source_value;
+                const float left_value = left_source_value;
                 float new_left;
                 float new_right;
                 if (left_power >= right_power)
@@ -973,10 +1222,10 @@ void MorphGroup::parameter_value_changed(Parameter *param_) noexcept
                         new_left = left_value;
                     }
                 }
-                left_source_param->set_value_without_notification(new_left);
-                right_source_param->set_value_without_notification(new_right);
-                jassert(current_value != left_power * left_source_param->get_value() +
-                                             right_power * right_source_param->get_value());
+                left_source_value = new_left;
+                right_source_value = new_right;
+                jassert(current_value !=
+                        left_power * left_source_value + right_power * right_source_value);
             }
         }
 #ifdef JUCE_DEBUG
@@ -993,8 +1242,9 @@ void MorphGroup::parameter_modulation_value_changed(Parameter *param_) noexcept
     const int param_id = params.indexOf(param_);
     if (param_id != -1)
     {
-        Parameter *const left_source_param = left_morph_source->params[param_id];
-        Parameter *const right_source_param = right_morph_source->params[param_id];
+        const mono_VersionGuard::ScopedWrite write(snapshot->guard);
+        float &left_source_modulation = left_source.modulation_amounts.getReference(param_id);
+        float &right_source_modulation = right_source.modulation_amounts.getReference(param_id);
 
         const double right_power = last_power_of_right;
         const double left_power = 1.0f - right_power;
@@ -1002,14 +1252,12 @@ void MorphGroup::parameter_modulation_value_changed(Parameter *param_) noexcept
         // KEEP THE RIGHT SIDE UNTOUCHED
         if (left_power == 1)
         {
-            left_source_param->set_modulation_amount_without_notification(
-                param_->get_modulation_amount());
+            left_source_modulation = param_->get_modulation_amount();
         }
         // KEEP THE LEFT SIDE UNTOUCHED
         else if (right_power == 1)
         {
-            right_source_param->set_modulation_amount_without_notification(
-                param_->get_modulation_amount());
+            right_source_modulation = param_->get_modulation_amount();
         }
         else
         {
@@ -1033,8 +1281,8 @@ void MorphGroup::parameter_modulation_value_changed(Parameter *param_) noexcept
             // (right_power/left_power)*right_value
 
             const float current_value = param_->get_modulation_amount();
-            const float right_value = right_source_param->get_modulation_amount();
-            const float left_value = left_source_param->get_modulation_amount();
+            const float right_value = right_source_modulation;
+            const float left_value = left_source_modulation;
             float new_left;
             float new_right;
             if (left_power >= right_power)
@@ -1077,10 +1325,10 @@ void MorphGroup::parameter_modulation_value_changed(Parameter *param_) noexcept
                     new_left = left_value;
                 }
             }
-            left_source_param->set_modulation_amount_without_notification(new_left);
-            right_source_param->set_modulation_amount_without_notification(new_right);
-            jassert(current_value != left_power * left_source_param->get_modulation_amount() +
-                                         right_power * right_source_param->get_modulation_amount());
+            left_source_modulation = new_left;
+            right_source_modulation = new_right;
+            jassert(current_value !=
+                    left_power * left_source_modulation + right_power * right_source_modulation);
         }
     }
 }
@@ -1327,7 +1575,7 @@ struct CREATE_SIN_LOOKUP
         float *table_ = new float[LOOKUP_TABLE_SIZE + 1];
         for (int i = 0; i < LOOKUP_TABLE_SIZE + 1; i++)
         {
-            table_[i] = std::sin(double(i) / TABLESIZE_MULTI);
+            table_[i] = std::sin(double(i) / LOOKUP_TABLE_SCALE);
         }
 
         return table_;
@@ -1343,7 +1591,7 @@ struct CREATE_COS_LOOKUP
         float *table_ = new float[LOOKUP_TABLE_SIZE + 1];
         for (int i = 0; i < LOOKUP_TABLE_SIZE + 1; i++)
         {
-            table_[i] = std::cos(double(i) / TABLESIZE_MULTI);
+            table_[i] = std::cos(double(i) / LOOKUP_TABLE_SCALE);
         }
 
         return table_;
@@ -1362,7 +1610,7 @@ struct CREATE_EXP_LOOKUP
 #define EXP_PI_05_CORRECTION 4.81048f
 #define LOG_PI_1_CORRECTION 1.42108f
 #define EXP_PI_1_CORRECTION 23.1407f
-            table_[i] = (std::exp(double(i) / TABLESIZE_MULTI) / EXP_PI_1_CORRECTION);
+            table_[i] = (std::exp(double(i) / LOOKUP_TABLE_SCALE) / EXP_PI_1_CORRECTION);
         }
 
         return table_;
@@ -1671,7 +1919,7 @@ COLD MoniqueSynthData::MoniqueSynthData(DATA_TYPES data_type, UiLookAndFeel *loo
 
       program_restore_block_time(1500),
 
-      force_morph_update__load_flag(false)
+      force_morph_update__load_flag(false), control_rate(1), control_rate_is_cubic(false)
 {
     // OSCS DATA
     fm_osc_data = new FMOscData(smooth_manager);
@@ -1779,9 +2027,6 @@ COLD MoniqueSynthData::~MoniqueSynthData() noexcept
     morph_group_3 = nullptr;
     morph_group_4 = nullptr;
 
-    left_morph_sources.clear();
-    right_morph_sources.clear();
-
     chorus_data = nullptr;
     eq_data = nullptr;
     arp_sequencer_data = nullptr;
@@ -2381,48 +2626,45 @@ morph_group_2->register_parameter(filter_datas[0]->env_data->shape.ptr(), data_t
 }
 
 // MAKE IT HOT
-// ONLY THE MASTER HAS MORPHE SORCES - OTHERWISE WE BUILD UNLIMITED SOURCES FOR SOURCE
+// ONLY THE MASTER HAS MORPHE SORCES - THE SOURCES START WITH THE FACTORY DEFAULT
 if (data_type == MASTER)
 {
-    for (int i = 0; i != SUM_MORPHER_GROUPS; ++i)
+    if (not factory_default)
     {
-        MoniqueSynthData *morph_data;
-        morph_data = new MoniqueSynthData(static_cast<DATA_TYPES>(MORPH_LEFT), nullptr, nullptr,
-                                          nullptr, nullptr, nullptr, nullptr, this);
-        // hat eine änderungscaskade zur folge!!!
-        morph_data->load_default();
-        left_morph_sources.add(morph_data);
-
-        morph_data = new MoniqueSynthData(static_cast<DATA_TYPES>(MORPH), nullptr, nullptr, nullptr,
-                                          nullptr, nullptr, nullptr, this);
-        // hat eine änderungscaskade zur folge!!!
-        morph_data->load_default();
-        right_morph_sources.add(morph_data);
-    }
-
-    // SETUP THE MORPH GROUP
-    // TODO, do not initalize the unneded morph groups
-    // TODO, only load and save the needed params
-    morph_group_1->set_sources(left_morph_sources[0]->morph_group_1,
-                               right_morph_sources[0]->morph_group_1, morhp_states[0],
-                               morhp_switch_states[0]);
-    morph_group_2->set_sources(left_morph_sources[1]->morph_group_2,
-                               right_morph_sources[1]->morph_group_2, morhp_states[1],
-                               morhp_switch_states[1]);
-    morph_group_3->set_sources(left_morph_sources[2]->morph_group_3,
-                               right_morph_sources[2]->morph_group_3, morhp_states[2],
-                               morhp_switch_states[2]);
-    morph_group_4->set_sources(left_morph_sources[3]->morph_group_4,
-                               right_morph_sources[3]->morph_group_4, morhp_states[3],
-                               morhp_switch_states[3]);
+        factory_default = XmlDocument::parse(BinaryData::FACTORTY_DEFAULT_mlprog).release();
+    }
 
     for (int morpher_id = 0; morpher_id != SUM_MORPHER_GROUPS; ++morpher_id)
     {
+        MorphGroup *const morph_group = get_morph_group(morpher_id);
+        morph_group->init_sources(morhp_states[morpher_id], morhp_switch_states[morpher_id],
+                                  &morph_snapshot);
+        if (factory_default)
+        {
+            morph_group->read_source_from(LEFT, *factory_default);
+            morph_group->read_source_from(RIGHT, *factory_default);
+        }
+
         morhp_states[morpher_id].register_listener(this);
     }
+
+    // THE SMOOTHERS READ THE LIVE VALUES OF THEIR PARAMS FROM THE SAME SNAPSHOT
+    smooth_manager->register_values(&morph_snapshot);
+}
 }
-left_morph_sources.minimiseStorageOverheads();
-right_morph_sources.minimiseStorageOverheads();
+MorphGroup *MoniqueSynthData::get_morph_group(int morpher_id_) const noexcept
+{
+    switch (morpher_id_)
+    {
+    case 0:
+        return morph_group_1;
+    case 1:
+        return morph_group_2;
+    case 2:
+        return morph_group_3;
+    default:
+        return morph_group_4;
+    }
 }
 const String &MoniqueSynthData::get_morph_source_name(int id_abs_) const noexcept
 {
@@ -2617,135 +2859,64 @@ void MoniqueSynthData::parameter_value_changed_by_automation(Parameter *param_)
 void MoniqueSynthData::set_morph_source_data_from_current(int morpher_id_, bool left_or_right_,
                                                           bool run_sync_morph_) noexcept
 {
-    MorphGroup *morph_group_to_update;
-    MorphGroup *morph_group_source;
-    switch (morpher_id_)
-    {
-    case 0:
+    // THE FIRST SNAPSHOT WITH THE NEW SOURCE ALSO SEES THE REQUEST
+    const mono_VersionGuard::ScopedWrite write(morph_snapshot.guard);
+    get_morph_group(morpher_id_)->set_source_from_current(left_or_right_);
+    if (left_or_right_ == LEFT)
     {
-        if (left_or_right_ == LEFT)
-        {
-            morph_group_to_update = left_morph_sources[0]->morph_group_1;
-            left_morph_source_names.getReference(0) = "USER";
-        }
-        else
-        {
-            morph_group_to_update = right_morph_sources[0]->morph_group_1;
-            right_morph_source_names.getReference(0) = "USER";
-        }
-
-        morph_group_source = morph_group_1;
-        break;
+        left_morph_source_names.getReference(morpher_id_) = "USER";
     }
-    case 1:
+    else
     {
-        if (left_or_right_ == LEFT)
-        {
-            morph_group_to_update = left_morph_sources[1]->morph_group_2;
-            left_morph_source_names.getReference(1) = "USER";
-        }
-        else
-        {
-            morph_group_to_update = right_morph_sources[1]->morph_group_2;
-            right_morph_source_names.getReference(1) = "USER";
-        }
-
-        morph_group_source = morph_group_2;
-        break;
+        right_morph_source_names.getReference(morpher_id_) = "USER";
     }
-    case 2:
-    {
-        if (left_or_right_ == LEFT)
-        {
-            morph_group_to_update = left_morph_sources[2]->morph_group_3;
-            left_morph_source_names.getReference(2) = "USER";
-        }
-        else
-        {
-            morph_group_to_update = right_morph_sources[2]->morph_group_3;
-            right_morph_source_names.getReference(2) = "USER";
-        }
 
-        morph_group_source = morph_group_3;
-        break;
-    }
-    case 3:
+    if (run_sync_morph_)
     {
-        if (left_or_right_ == LEFT)
-        {
-            morph_group_to_update = left_morph_sources[3]->morph_group_4;
-            left_morph_source_names.getReference(3) = "USER";
-        }
-        else
-        {
-            morph_group_to_update = right_morph_sources[3]->morph_group_4;
-            right_morph_source_names.getReference(3) = "USER";
-        }
-
-        morph_group_source = morph_group_4;
-        break;
-    }
+        run_sync_morph();
     }
+}
 
-    for (int i = 0; i != morph_group_to_update->params.size(); ++i)
+static inline File get_program_file(const String &bank_name_, const String &program_name_) noexcept;
+bool MoniqueSynthData::load_programm_to_morph_source(int morpher_id_, bool left_or_right_,
+                                                     int bank_id_, int index_) noexcept
+{
+    if (bank_id_ < 0 or bank_id_ >= banks.size() or index_ < 0 or
+        index_ >= program_names_per_bank.getReference(bank_id_).size())
     {
-        Parameter *param(morph_group_to_update->params.getUnchecked(i));
-        Parameter *source_param(morph_group_source->params.getUnchecked(i));
-        param->set_value_without_notification(source_param->get_value());
-        param->set_modulation_amount_without_notification(source_param->get_modulation_amount());
+        return false;
     }
-    for (int i = 0; i != morph_group_to_update->switch_bool_params.size(); ++i)
+
+    const String &program_name = program_names_per_bank.getReference(bank_id_)[index_];
+    ScopedPointer<XmlElement> xml =
+        XmlDocument(get_program_file(banks[bank_id_], program_name)).getDocumentElement().release();
+    if (not xml or not(xml->hasTagName("PROJECT-1.0") || xml->hasTagName("MONOLisa")))
     {
-        BoolParameter *param(morph_group_to_update->switch_bool_params.getUnchecked(i));
-        BoolParameter *source_param(morph_group_source->switch_bool_params.getUnchecked(i));
-        param->set_value_without_notification(source_param->get_value());
+        return false;
     }
-    for (int i = 0; i != morph_group_to_update->switch_int_params.size(); ++i)
+
+    get_morph_group(morpher_id_)->read_source_from(left_or_right_, *xml);
+    if (left_or_right_ == LEFT)
     {
-        IntParameter *param(morph_group_to_update->switch_int_params.getUnchecked(i));
-        IntParameter *source_param(morph_group_source->switch_int_params.getUnchecked(i));
-        param->set_value_without_notification(source_param->get_value());
+        left_morph_source_names.getReference(morpher_id_) = program_name;
     }
-
-    if (run_sync_morph_)
+    else
     {
-        run_sync_morph();
+        right_morph_source_names.getReference(morpher_id_) = program_name;
     }
-}
 
-void MoniqueSynthData::refresh_morph_programms() noexcept
-{
-    left_morph_sources.getUnchecked(0)->banks = banks;
-    left_morph_sources.getUnchecked(1)->banks = banks;
-    left_morph_sources.getUnchecked(2)->banks = banks;
-    left_morph_sources.getUnchecked(3)->banks = banks;
-    right_morph_sources.getUnchecked(0)->banks = banks;
-    right_morph_sources.getUnchecked(1)->banks = banks;
-    right_morph_sources.getUnchecked(2)->banks = banks;
-    right_morph_sources.getUnchecked(3)->banks = banks;
-    left_morph_sources.getUnchecked(0)->program_names_per_bank = program_names_per_bank;
-    left_morph_sources.getUnchecked(1)->program_names_per_bank = program_names_per_bank;
-    left_morph_sources.getUnchecked(2)->program_names_per_bank = program_names_per_bank;
-    left_morph_sources.getUnchecked(3)->program_names_per_bank = program_names_per_bank;
-    right_morph_sources.getUnchecked(0)->program_names_per_bank = program_names_per_bank;
-    right_morph_sources.getUnchecked(1)->program_names_per_bank = program_names_per_bank;
-    right_morph_sources.getUnchecked(2)->program_names_per_bank = program_names_per_bank;
-    right_morph_sources.getUnchecked(3)->program_names_per_bank = program_names_per_bank;
+    return true;
 }
-
 bool MoniqueSynthData::try_to_load_programm_to_left_side(int morpher_id_, int bank_id_,
                                                          int index_) noexcept
 {
-    MoniqueSynthData *synth_data = left_morph_sources.getUnchecked(morpher_id_);
-    synth_data->set_current_bank(bank_id_);
-    synth_data->set_current_program(index_);
-    bool success = synth_data->load();
+    // THE FIRST SNAPSHOT WITH THE NEW SOURCE ALSO SEES THE REQUEST
+    const mono_VersionGuard::ScopedWrite write(morph_snapshot.guard);
+    const bool success = load_programm_to_morph_source(morpher_id_, LEFT, bank_id_, index_);
     if (success)
     {
         run_sync_morph();
         morph_switch_buttons(morpher_id_, false);
-        left_morph_source_names.getReference(morpher_id_) =
-            synth_data->get_current_program_name_abs();
     }
 
     return success;
@@ -2753,15 +2924,12 @@ bool MoniqueSynthData::try_to_load_programm_to_left_side(int morpher_id_, int ba
 bool MoniqueSynthData::try_to_load_programm_to_right_side(int morpher_id_, int bank_id_,
                                                           int index_) noexcept
 {
-    MoniqueSynthData *synth_data = right_morph_sources.getUnchecked(morpher_id_);
-    synth_data->set_current_bank(bank_id_);
-    synth_data->set_current_program(index_);
-    bool success = synth_data->load();
+    // THE FIRST SNAPSHOT WITH THE NEW SOURCE ALSO SEES THE REQUEST
+    const mono_VersionGuard::ScopedWrite write(morph_snapshot.guard);
+    const bool success = load_programm_to_morph_source(morpher_id_, RIGHT, bank_id_, index_);
     if (success)
     {
         run_sync_morph();
-        right_morph_source_names.getReference(morpher_id_) =
-            synth_data->get_current_program_name_abs();
     }
 
     return success;
@@ -2932,7 +3100,6 @@ void MoniqueSynthData::refresh_banks_and_programms(MoniqueSynthData &synth_data)
     }
 
     synth_data.calc_current_program_abs();
-    synth_data.refresh_morph_programms();
 }
 void MoniqueSynthData::calc_current_program_abs() noexcept
 {
@@ -3384,14 +3551,17 @@ void MoniqueSynthData::save_to(XmlElement *xml_) noexcept
         {
             for (int morpher_id = 0; morpher_id != SUM_MORPHER_GROUPS; ++morpher_id)
             {
+                MorphGroup *const morph_group = get_morph_group(morpher_id);
                 xml_->setAttribute(String("left_morph_source_") + String(morpher_id),
                                    left_morph_source_names[morpher_id]);
-                left_morph_sources[morpher_id]->save_to(
-                    xml_->createNewChildElement(String("LeftMorphData_") + String(morpher_id)));
+                morph_group->save_source_to(
+                    LEFT,
+                    *xml_->createNewChildElement(String("LeftMorphData_") + String(morpher_id)));
                 xml_->setAttribute(String("right_morph_source_") + String(morpher_id),
                                    right_morph_source_names[morpher_id]);
-                right_morph_sources[morpher_id]->save_to(
-                    xml_->createNewChildElement(String("RightMorphData_") + String(morpher_id)));
+                morph_group->save_source_to(
+                    RIGHT,
+                    *xml_->createNewChildElement(String("RightMorphData_") + String(morpher_id)));
             }
 
             for (int i = 0; i != saveable_parameters.size(); ++i)
@@ -3421,6 +3591,10 @@ void MoniqueSynthData::read_from(const XmlElement *xml_) noexcept
 {
     if (xml_)
     {
+        // THE AUDIO THREAD KEEPS ITS LAST SNAPSHOT UNTIL THE PARAMS, SOURCES AND STATES OF ALL
+        // GROUPS ARE LOADED
+        const mono_VersionGuard::ScopedWrite write(morph_snapshot.guard);
+
         // PARAMS
         {
             for (int i = 0; i != saveable_parameters.size(); ++i)
@@ -3452,14 +3626,21 @@ void MoniqueSynthData::read_from(const XmlElement *xml_) noexcept
 
             for (int morpher_id = 0; morpher_id != SUM_MORPHER_GROUPS; ++morpher_id)
             {
+                MorphGroup *const morph_group = get_morph_group(morpher_id);
                 left_morph_source_names.getReference(morpher_id) = xml_->getStringAttribute(
                     String("left_morph_source_") + String(morpher_id), "FACTORY DEFAULT");
-                left_morph_sources[morpher_id]->read_from(
-                    xml_->getChildByName(String("LeftMorphData_") + String(morpher_id)));
+                if (const XmlElement *left_xml =
+                        xml_->getChildByName(String("LeftMorphData_") + String(morpher_id)))
+                {
+                    morph_group->read_source_from(LEFT, *left_xml);
+                }
                 right_morph_source_names.getReference(morpher_id) = xml_->getStringAttribute(
                     String("right_morph_source_") + String(morpher_id), "FACTORY DEFAULT");
-                right_morph_sources[morpher_id]->read_from(
-                    xml_->getChildByName(String("RightMorphData_") + String(morpher_id)));
+                if (const XmlElement *right_xml =
+                        xml_->getChildByName(String("RightMorphData_") + String(morpher_id)))
+                {
+                    morph_group->read_source_from(RIGHT, *right_xml);
+                }
                 force_morph_update__load_flag = true;
             }
 
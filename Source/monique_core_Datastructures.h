@@ -2,6 +2,7 @@
 #define MONOSYNTH_DATA_H_INCLUDED
 
 #include "App.h"
+#include "monique_core_LockFree.h"
 
 #define FACTORY_NAME "FACTORY DEFAULT (SCRATCH)"
 
@@ -122,46 +123,114 @@ enum TRACKING_MODES
 //==============================================================================
 class MoniqueAudioProcessor;
 class mono_AudioDeviceManager;
+class DataBuffer;
+// THE INTERFACE OF mono_AudioSampleBuffer, BUT THE CHANNELS ARE CARVED FROM THE ARENA OF THE
+// DataBuffer, EVERY CHANNEL STARTS AT A CACHE LINE
+template <int num_channels> class mono_ArenaBuffer
+{
+    float *channels;
+    int channel_stride;
+    int size;
+
+    friend class DataBuffer;
+    // RETURNS THE OFFSET BEHIND THE LAST CHANNEL, NOTHING IS PLACED WITHOUT AN ARENA
+    inline int place(float *arena_, int offset_, int size_, int channel_stride_) noexcept
+    {
+        if (arena_)
+        {
+            channels = arena_ + offset_;
+            channel_stride = channel_stride_;
+            size = size_;
+        }
+        return offset_ + num_channels * channel_stride_;
+    }
+
+  public:
+    inline const float *getReadPointer(int channel_ = 0) const noexcept
+    {
+#ifdef JUCE_DEBUG
+        check_side_offset(channel_);
+#endif
+        return channels + channel_ * channel_stride;
+    }
+    inline float *getWritePointer(int channel_ = 0) noexcept
+    {
+#ifdef JUCE_DEBUG
+        check_side_offset(channel_);
+#endif
+        return channels + channel_ * channel_stride;
+    }
+    inline int get_size() const noexcept { return size; }
+
+  private:
+#ifdef JUCE_DEBUG
+    void check_side_offset(int channel_) const noexcept
+    {
+        if (channels[channel_ * channel_stride + size] != 0)
+        {
+            std::cout << "buffer size overwriten " << channels[channel_ * channel_stride + size]
+                      << " size:" << size << std::endl;
+        }
+    }
+#endif
+
+  public:
+    //==========================================================================
+    mono_ArenaBuffer() noexcept : channels(nullptr), channel_stride(0), size(0) {}
+
+    JUCE_DECLARE_NON_COPYABLE(mono_ArenaBuffer)
+};
+
+//==============================================================================
 class DataBuffer // DEFINITION IN SYNTH.CPP
 {
     int size;
 
+    // ONE 64 BYTE ALIGNED BLOCK FOR ALL WORKERS, IT ONLY GROWS
+    HeapBlock<char> arena_memory;
+    float *arena;
+    int capacity;
+
   public:
     // ==============================================================================
-    // WORKERS
+    // WORKERS, IN THE ORDER OF THE PROCESSING
     // TODO REDUCE TO NEEDED
-    mono_AudioSampleBuffer<SUM_EQ_BANDS> band_env_buffers;
-    mono_AudioSampleBuffer<SUM_EQ_BANDS> band_out_buffers;
+    mono_ArenaBuffer<1> velocity_buffer;
 
-    mono_AudioSampleBuffer<SUM_FILTERS> lfo_amplitudes;
-    mono_AudioSampleBuffer<SUM_MORPHER_GROUPS> mfo_amplitudes;
-    mono_AudioSampleBuffer<SUM_FILTERS * 2> filter_output_samples_l_r;
-    mono_AudioSampleBuffer<2> filter_stereo_output_samples;
+    mono_ArenaBuffer<SUM_MORPHER_GROUPS> mfo_amplitudes;
+    mono_ArenaBuffer<SUM_FILTERS> lfo_amplitudes;
 
-    mono_AudioSampleBuffer<SUM_OSCS> osc_samples;
-    mono_AudioSampleBuffer<1> osc_switchs;
-    mono_AudioSampleBuffer<1> osc_sync_switchs;
-    mono_AudioSampleBuffer<1> modulator_samples;
+    mono_ArenaBuffer<SUM_OSCS> osc_samples;
+    mono_ArenaBuffer<1> osc_switchs;
+    mono_ArenaBuffer<1> osc_sync_switchs;
+    mono_ArenaBuffer<1> modulator_samples;
 
-    mono_AudioSampleBuffer<1> final_env;
+    mono_ArenaBuffer<SUM_FILTERS> filter_env_amps;
 #ifdef POLY
-    mono_AudioSampleBuffer<SUM_FILTERS> filter_env_tracking;
+    mono_ArenaBuffer<SUM_FILTERS> filter_env_tracking;
 #endif
-    mono_AudioSampleBuffer<1> chorus_env;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_env_amps;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_samples;
+    mono_ArenaBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_output_samples;
+    mono_ArenaBuffer<SUM_FILTERS * 2> filter_output_samples_l_r;
+    mono_ArenaBuffer<2> filter_stereo_output_samples;
 
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_samples;
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_input_env_amps;
-    mono_AudioSampleBuffer<SUM_INPUTS_PER_FILTER * SUM_FILTERS> filter_output_samples;
-    mono_AudioSampleBuffer<SUM_FILTERS> filter_env_amps;
+    mono_ArenaBuffer<SUM_EQ_BANDS> band_env_buffers;
+    mono_ArenaBuffer<SUM_EQ_BANDS> band_out_buffers;
 
-    mono_AudioSampleBuffer<1> tmp_buffer;
-    mono_AudioSampleBuffer<1> second_mono_buffer;
+    mono_ArenaBuffer<1> chorus_env;
+    mono_ArenaBuffer<1> final_env;
 
-    mono_AudioSampleBuffer<1> velocity_buffer;
+    mono_ArenaBuffer<1> tmp_buffer;
+    mono_ArenaBuffer<1> second_mono_buffer;
 
   private:
     // ==============================================================================
+    // PLACES THE WORKERS AND RETURNS THE NUMBER OF FLOATS THEY NEED
+    int place_buffers(float *arena_, int channel_stride_) noexcept;
+
     friend class MoniqueAudioProcessor;
+    // PREPARE TO PLAY WITH THE MAX BLOCK SIZE, SMALLER BLOCKS DO NOT ALLOCATE
     COLD void resize_buffer_if_required(int size_) noexcept;
 
   public:
@@ -409,12 +478,16 @@ struct RuntimeInfo
 //==============================================================================
 class MorphGroup;
 class SmoothedParameter;
+class mono_ParameterSnapshot;
 class SmoothManager : public RuntimeListener, DeletedAtShutdown
 {
     friend class SmoothedParameter;
     Array<SmoothedParameter *> smoothers;
     RuntimeNotifyer *const notifyer;
 
+    // INIT, AFTER ALL SMOOTHERS ARE CREATED
+    COLD void register_values(mono_ParameterSnapshot *snapshot_) noexcept;
+
     //==========================================================================
     friend class MoniqueSynthData;
     friend class ContainerDeletePolicy<SmoothManager>;
@@ -441,17 +514,34 @@ class SmoothManager : public RuntimeListener, DeletedAtShutdown
 class ENV;
 class SmoothedParameter : RuntimeListener
 {
+    friend class SmoothManager;
+    friend class MorphGroup;
     SmoothManager *const smooth_manager;
 
     mono_AudioSampleBuffer<1> values;
     mono_AudioSampleBuffer<1> modulation_power;
 
+    // THE WHOLE BUFFER HOLDS ONE VALUE, IT IS NOT WRITTEN AGAIN UNTIL THE VALUE CHANGES
+    bool values_are_constant;
+    float constant_value;
+    bool modulation_is_constant;
+    float constant_modulation;
+    inline void set_constant_values(float value_) noexcept;
+    inline void set_constant_modulation(float value_) noexcept;
+
+    int smooth_motor_time_in_ms;
+
   public:
     Parameter *const param_to_smooth;
     float const max_value;
     float const min_value;
 
   private:
+    // THE LIVE VALUE OF param_to_smooth, SEE SmoothManager::register_values
+    const mono_ParameterSnapshot *snapshot;
+    int value_offset;
+    int modulation_offset;
+
     //==========================================================================
     LinearSmoother simple_smoother;
 
@@ -471,8 +561,8 @@ class SmoothedParameter : RuntimeListener
     void smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
                           int smooth_motor_time_in_ms_, int glide_motor_time_in_ms_,
                           const float *morph_amp_buffer_, float morph_slider_state_,
-                          const Parameter *left_source_param_, const Parameter *right_source_param_,
-                          int num_samples_) noexcept;
+                          float left_value_, float right_value_, float left_modulation_,
+                          float right_modulation_, int num_samples_) noexcept;
 
   private:
     //==========================================================================
@@ -496,6 +586,9 @@ class SmoothedParameter : RuntimeListener
     {
         return values.getReadPointer();
     }
+    // THE SMOOTHED VALUES OF THIS BLOCK ARE ALL get_constant_value()
+    inline bool is_constant() const noexcept { return values_are_constant; }
+    inline float get_constant_value() const noexcept { return constant_value; }
     inline void sample_rate_or_block_changed() noexcept override;
 
     //==========================================================================
@@ -1255,10 +1348,80 @@ struct ChorusData
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// DENSE, 64 BYTE ALIGNED COPY OF FLOAT ARRAYS AND SINGLE PARAMETER VALUES THAT THE AUDIO THREAD
+// READS AS ONE CONSISTENT STATE. BATCHES OF WRITES (PROGRAM LOADS, MORPHS) RUN INSIDE A SCOPE OF
+// guard, update() COPIES EVERYTHING ONCE PER BLOCK INTO THE BACK BUFFER AND SWAPS IT TO THE FRONT
+// IF NO WRITE SCOPE WAS OPEN MEANWHILE. OTHERWISE THE BLOCK KEEPS THE LAST SNAPSHOT.
+class mono_ParameterSnapshot
+{
+    struct Region
+    {
+        const float *source;
+        int offset;
+        int size;
+    };
+    Array<Region> regions;
+    struct Value
+    {
+        const float *source;
+        int offset;
+    };
+    Array<Value> values;
+
+    HeapBlock<char> memory;
+    float *front;
+    float *back;
+    int size;
+    int next_value_offset;
+    int num_free_value_slots;
+
+    COLD void reallocate() noexcept;
+    inline void copy_to(float *dest_) const noexcept;
+
+  public:
+    mono_VersionGuard guard;
+
+    //==========================================================================
+    // AUDIO THREAD
+    inline const float *get() const noexcept { return front; }
+    // FALSE IF THE BLOCK KEEPS THE LAST SNAPSHOT
+    bool update() noexcept;
+
+    //==========================================================================
+    // INIT, THE SOURCE MUST NOT MOVE ANYMORE. RETURNS ITS OFFSET IN THE SNAPSHOT.
+    COLD int add_region(const float *source_, int size_) noexcept;
+    COLD int add_value(const float *source_) noexcept;
+
+  public:
+    //==========================================================================
+    COLD mono_ParameterSnapshot() noexcept;
+    COLD ~mono_ParameterSnapshot() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_ParameterSnapshot)
+};
+
+//==============================================================================
+// 100 STEPS OF 10MS ON THE MESSAGE THREAD BEFORE
+#define SYNC_MORPH_TIME_IN_MS 1000
+// NO BLOCK HAS MOVED THE SYNC MORPH FOR THIS LONG, THE HOST HAS SUSPENDED THE PROCESSING OR THERE
+// IS NO AUDIO DEVICE
+#define SYNC_MORPH_TIMEOUT_IN_MS (SYNC_MORPH_TIME_IN_MS + 500)
 class MorphGroup : public Timer, ParameterListener
 {
-    MorphGroup *left_morph_source;
-    MorphGroup *right_morph_source;
+  public:
+    // THE VALUES OF ONE SIDE, FLAT AND IN THE ORDER OF params, switch_bool_params AND
+    // switch_int_params. THE PARAMS ARE ONLY REGISTERED IN THE MASTER, THE FILES USE THEIR NAMES.
+    struct Source
+    {
+        Array<float> values;
+        Array<float> modulation_amounts;
+        Array<bool> bool_switches;
+        Array<int> int_switches;
+    };
+
+  private:
+    Source left_source;
+    Source right_source;
 
     friend class MoniqueSynthData;
     friend class SmoothManager;
@@ -1268,6 +1431,33 @@ class MorphGroup : public Timer, ParameterListener
     bool current_switch;
     Array<IntParameter *> switch_int_params;
 
+    HeapBlock<float> morph_buffer;
+
+    // THE SOURCES AND last_power_of_right ARE ONLY WRITTEN IN A SCOPE OF THE SNAPSHOT GUARD, THE
+    // AUDIO THREAD READS THEM FROM THE SNAPSHOT AT THESE OFFSETS
+    mono_ParameterSnapshot *snapshot;
+    int left_values_offset;
+    int right_values_offset;
+    int left_modulations_offset;
+    int right_modulations_offset;
+    int power_of_right_offset;
+
+    inline Source &get_source(bool left_or_right_) noexcept
+    {
+        return left_or_right_ == RIGHT ? right_source : left_source;
+    }
+
+  public:
+    // THE SMOOTHED PARAMS OF THE GROUP WITH THEIR SLOT IN THE SOURCES, BUILT BY init_sources
+    struct SmoothedMorphParameter
+    {
+        SmoothedParameter *smoother;
+        int index;
+    };
+
+  private:
+    Array<SmoothedMorphParameter> smoothed_params;
+
   public:
     //==========================================================================
     inline int indexOf(const Parameter *param_) const noexcept
@@ -1296,13 +1486,9 @@ class MorphGroup : public Timer, ParameterListener
 
         return -1;
     }
-    inline const Parameter *get_left_param(int index_) const noexcept
+    inline const Array<SmoothedMorphParameter> &get_smoothed_params() const noexcept
     {
-        return left_morph_source->params.getUnchecked(index_);
-    }
-    inline const Parameter *get_right_param(int index_) const noexcept
-    {
-        return right_morph_source->params.getUnchecked(index_);
+        return smoothed_params;
     }
 
     inline void morph(float morph_amount_) noexcept;
@@ -1310,15 +1496,42 @@ class MorphGroup : public Timer, ParameterListener
 
   private:
     //==========================================================================
-    Array<float> sync_param_deltas;
-    Array<float> sync_modulation_deltas;
+    // THE SYNC MORPH MOVES THE SMOOTHERS FROM WHERE THEY ARE TO THE MORPH OF THE SOURCES. IT IS A
+    // BLOCK RATE RAMP OF THE RENDER THAT NEVER TOUCHES THE PARAMS, run_sync_morph() ONLY COUNTS
+    // A REQUEST FOR THE NEXT BLOCK. ONCE THE RENDER HAS SERVED THE LAST REQUEST THE TIMER SETS
+    // THE PARAMS TO THE MORPH ON THE MESSAGE THREAD, SO THE HOST IS NOTIFIED ONCE. IF THE RENDER
+    // STALLS THE TIMER SETS THEM AFTER SYNC_MORPH_TIMEOUT_IN_MS WITHOUT IT.
+    std::atomic<int> num_sync_morph_requests;
+    std::atomic<int> num_sync_morph_requests_done;
+    std::atomic<int> num_sync_morph_blocks;
+    int current_sync_morph_request;
+    int last_num_sync_morph_blocks;
+    uint32 last_sync_morph_block_ms;
+    HeapBlock<float> sync_start_values;
+    HeapBlock<float> sync_start_modulations;
+    HeapBlock<float> sync_values;
+    HeapBlock<float> sync_modulations;
+    int sync_morph_samples;
+    int sync_morph_samples_left;
     void run_sync_morph() noexcept;
-    int current_callbacks;
     void timerCallback() override;
 
+  public:
+    // AUDIO THREAD, BEFORE THE SMOOTHERS OF THE GROUP, snapshot_ IS THE SNAPSHOT OF THE BLOCK.
+    // TRUE IF THE SMOOTHERS FOLLOW THE SYNC VALUES INSTEAD OF THE SOURCES IN THIS BLOCK.
+    bool process_sync_morph(const float *snapshot_, int num_samples_,
+                            double sample_rate_) noexcept;
+    // IN THE ORDER OF params, ONLY THE SMOOTHED ONES ARE WRITTEN
+    inline const float *get_sync_values() const noexcept { return sync_values; }
+    inline const float *get_sync_modulations() const noexcept { return sync_modulations; }
+    // MESSAGE THREAD, TRUE IF THE LAST REQUEST IS DONE AND THE PARAMS ARE SET
+    bool finish_sync_morph() noexcept;
+    // MESSAGE THREAD, TRUE IF NO BLOCK HAS MOVED THE SYNC MORPH SINCE SYNC_MORPH_TIMEOUT_IN_MS
+    // BEFORE now_ms_ AND THE PARAMS ARE SET
+    bool finish_stalled_sync_morph(uint32 now_ms_) noexcept;
+
   private:
     //==========================================================================
-    // WILL ONLY BE CALLED IN THE MASTER MORPH GROUP, COZ THE SUB GROUBS DOES NOT LISTEN THE PARAMS
     // UPDATES THE LEFT AND RIGHT SOURCES
     void parameter_value_changed(Parameter *param_) noexcept override;
     void parameter_modulation_value_changed(Parameter *param_) noexcept override;
@@ -1333,8 +1546,14 @@ class MorphGroup : public Timer, ParameterListener
     COLD void register_switch_parameter(BoolParameter *param_, bool is_master_) noexcept;
     COLD void register_switch_parameter(IntParameter *param_, bool is_master_) noexcept;
 
-    COLD void set_sources(MorphGroup *left_source_, MorphGroup *right_source_,
-                          float current_morph_amount_, bool current_switch_state_) noexcept;
+    // SIZES THE SOURCES TO THE REGISTERED PARAMS, BOTH START WITH THEIR CURRENT VALUES
+    COLD void init_sources(float current_morph_amount_, bool current_switch_state_,
+                           mono_ParameterSnapshot *snapshot_) noexcept;
+
+    // SOURCES
+    void set_source_from_current(bool left_or_right_) noexcept;
+    void save_source_to(bool left_or_right_, XmlElement &xml_) const noexcept;
+    void read_source_from(bool left_or_right_, const XmlElement &xml_) noexcept;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MorphGroup)
 };
@@ -1404,6 +1623,9 @@ struct MoniqueSynthData : ParameterListener
 
     MoniqueTuningData *const tuning;
 
+    // BEFORE THE PARAMETERS, THEY STOP THEIR RAMPS WHEN THEY GO
+    SharedResourcePointer<ChangeParamOverTime> param_change_scheduler;
+
     const int id;
 
     BoolParameter is_stereo;
@@ -1566,11 +1788,11 @@ struct MoniqueSynthData : ParameterListener
     IntParameter morph_motor_time;
 
   public:
+    // THE AUDIO THREAD READS THE MORPH SOURCES AND STATES FROM HERE
+    mono_ParameterSnapshot morph_snapshot;
     ScopedPointer<MorphGroup> morph_group_1, morph_group_2, morph_group_3, morph_group_4;
 
   private:
-    OwnedArray<MoniqueSynthData> left_morph_sources;
-    OwnedArray<MoniqueSynthData> right_morph_sources;
     StringArray left_morph_source_names;
     StringArray right_morph_source_names;
 
@@ -1579,6 +1801,7 @@ struct MoniqueSynthData : ParameterListener
 
   private:
     COLD void init_morph_groups(DATA_TYPES data_type, MoniqueSynthData *master_data_) noexcept;
+    MorphGroup *get_morph_group(int morpher_id_) const noexcept;
 
     CriticalSection morph_lock;
 
@@ -1598,10 +1821,13 @@ struct MoniqueSynthData : ParameterListener
     // COPY THE CURRENT STATE TO THE SOURCES
     void set_morph_source_data_from_current(int morpher_id_, bool left_or_right_,
                                             bool run_sync_morph_) noexcept;
-    void refresh_morph_programms() noexcept;
     bool try_to_load_programm_to_left_side(int morpher_id_, int bank_id_, int index_) noexcept;
     bool try_to_load_programm_to_right_side(int morpher_id_, int bank_id_, int index_) noexcept;
 
+  private:
+    bool load_programm_to_morph_source(int morpher_id_, bool left_or_right_, int bank_id_,
+                                       int index_) noexcept;
+
   private:
     // ==============================================================================
     // ==============================================================================
@@ -1682,6 +1908,9 @@ struct MoniqueSynthData : ParameterListener
     void load_default() noexcept;
     void save_to(XmlElement *xml) noexcept;
     bool force_morph_update__load_flag;
+    // 1 COMPUTES THE LFOS, MFOS AND ENVELOPES PER SAMPLE, N ONLY EVERY N SAMPLES AND INTERPOLATES
+    std::atomic<int> control_rate;
+    std::atomic<bool> control_rate_is_cubic;
     void read_from(const XmlElement *xml) noexcept;
 
   private:
@@ -0,0 +1,65 @@
+#ifndef MONIQUE_CORE_FASTMATH_H_INCLUDED
+#define MONIQUE_CORE_FASTMATH_H_INCLUDED
+
+#include "monique_core_SIMD.h"
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// ATAN
+//
+// RANGE REDUCTION TO [0,1] WITH atan(x) = PI/2 - atan(1/x) AND AN ODD DEGREE 9 POLYNOMIAL
+// (HASTINGS). MAX ABSOLUTE ERROR 1.2e-5 OVER THE FULL FLOAT RANGE, NO BRANCHES IN THE SIMD AND
+// BLOCK VERSIONS.
+#define FAST_ATAN_MAX_ERROR 2.0e-5f
+
+#define FAST_ATAN_C1 0.9998660f
+#define FAST_ATAN_C3 -0.3302995f
+#define FAST_ATAN_C5 0.1801410f
+#define FAST_ATAN_C7 -0.0851330f
+#define FAST_ATAN_C9 0.0208351f
+#define FAST_ATAN_PI_2 1.57079632679f
+
+static inline float fast_atan(float x_) noexcept
+{
+    const float a = std::fabs(x_);
+    const float z = a > 1 ? 1.0f / a : a;
+    const float z2 = z * z;
+    float r =
+        z * (FAST_ATAN_C1 +
+             z2 * (FAST_ATAN_C3 + z2 * (FAST_ATAN_C5 + z2 * (FAST_ATAN_C7 + z2 * FAST_ATAN_C9))));
+    if (a > 1)
+    {
+        r = FAST_ATAN_PI_2 - r;
+    }
+
+    return std::copysign(r, x_);
+}
+static inline mono_float4 fast_atan(mono_float4 x_) noexcept
+{
+    const mono_float4 one = mono_float4::broadcast(1);
+    const mono_float4 a = simd_abs(x_);
+    const mono_float4 z = simd_min(a, one) / simd_max(a, one);
+    const mono_float4 z2 = z * z;
+    const mono_float4 r =
+        z * ((((z2 * FAST_ATAN_C9 + FAST_ATAN_C7) * z2 + FAST_ATAN_C5) * z2 + FAST_ATAN_C3) * z2 +
+             FAST_ATAN_C1);
+
+    return simd_copy_sign(
+        simd_select_greater(a, one, mono_float4::broadcast(FAST_ATAN_PI_2) - r, r), x_);
+}
+// dest_ MAY BE source_
+static inline void fast_atan(const float *source_, float *dest_, int num_samples_) noexcept
+{
+    int sid = 0;
+    for (; sid <= num_samples_ - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+    {
+        fast_atan(mono_float4::load(source_ + sid)).store(dest_ + sid);
+    }
+    for (; sid < num_samples_; ++sid)
+    {
+        dest_[sid] = fast_atan(source_[sid]);
+    }
+}
+
+#endif // MONIQUE_CORE_FASTMATH_H_INCLUDED
@@ -0,0 +1,110 @@
+#ifndef MONIQUE_CORE_LOCKFREE_H_INCLUDED
+#define MONIQUE_CORE_LOCKFREE_H_INCLUDED
+
+#include <atomic>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// WAIT FREE RING FOR ONE PRODUCER AND ONE CONSUMER THREAD, E.G. UI -> AUDIO.
+// capacity_ MUST BE A POWER OF TWO, ONE SLOT STAYS EMPTY.
+template <typename T, int capacity_> class mono_SPSCQueue
+{
+    static_assert((capacity_ & (capacity_ - 1)) == 0, "capacity_ must be a power of two");
+
+    T items[capacity_];
+    std::atomic<int> write_index;
+    std::atomic<int> read_index;
+
+  public:
+    // PRODUCER ONLY, FALSE IF FULL
+    inline bool push(const T &item_) noexcept
+    {
+        const int write = write_index.load(std::memory_order_relaxed);
+        const int next = (write + 1) & (capacity_ - 1);
+        if (next == read_index.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        items[write] = item_;
+        write_index.store(next, std::memory_order_release);
+        return true;
+    }
+    // CONSUMER ONLY, FALSE IF EMPTY
+    inline bool pop(T &item_) noexcept
+    {
+        const int read = read_index.load(std::memory_order_relaxed);
+        if (read == write_index.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        item_ = items[read];
+        read_index.store((read + 1) & (capacity_ - 1), std::memory_order_release);
+        return true;
+    }
+
+  public:
+    //==========================================================================
+    mono_SPSCQueue() noexcept : items(), write_index(0), read_index(0) {}
+
+  private:
+    mono_SPSCQueue(const mono_SPSCQueue &) = delete;
+    mono_SPSCQueue &operator=(const mono_SPSCQueue &) = delete;
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// VERSION COUNTER FOR DATA THAT ANY THREAD WRITES IN BATCHES AND ONE THREAD READS WITHOUT EVER
+// WAITING, LIKE A SEQUENCE LOCK WITH MORE THAN ONE WRITER. THE READER COPIES THE DATA BETWEEN
+// begin_read() AND end_read() AND THROWS THE COPY AWAY IF A WRITE SCOPE WAS OPEN MEANWHILE.
+class mono_VersionGuard
+{
+    std::atomic<int> num_writers;
+    std::atomic<unsigned int> version;
+
+  public:
+    // WRITERS, THE SCOPES CAN NEST
+    inline void begin_write() noexcept
+    {
+        num_writers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    inline void end_write() noexcept
+    {
+        version.fetch_add(1, std::memory_order_release);
+        num_writers.fetch_sub(1, std::memory_order_release);
+    }
+    struct ScopedWrite
+    {
+        mono_VersionGuard &guard;
+        ScopedWrite(mono_VersionGuard &guard_) noexcept : guard(guard_) { guard.begin_write(); }
+        ~ScopedWrite() noexcept { guard.end_write(); }
+    };
+
+    // READER, FALSE IF A WRITER IS ACTIVE
+    inline bool begin_read(unsigned int &version_) const noexcept
+    {
+        version_ = version.load(std::memory_order_acquire);
+        return num_writers.load(std::memory_order_acquire) == 0;
+    }
+    // READER, FALSE IF THE DATA MAY HAVE CHANGED SINCE begin_read()
+    inline bool end_read(unsigned int version_) const noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return num_writers.load(std::memory_order_acquire) == 0 and
+               version.load(std::memory_order_acquire) == version_;
+    }
+
+  public:
+    //==========================================================================
+    mono_VersionGuard() noexcept : num_writers(0), version(0) {}
+
+  private:
+    mono_VersionGuard(const mono_VersionGuard &) = delete;
+    mono_VersionGuard &operator=(const mono_VersionGuard &) = delete;
+};
+
+#endif // MONIQUE_CORE_LOCKFREE_H_INCLUDED
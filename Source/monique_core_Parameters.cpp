@@ -57,18 +57,11 @@ COLD ParameterInfo::~ParameterInfo() noexcept {}
 COLD ParameterRuntimeInfo::ParameterRuntimeInfo() noexcept
     : my_smoother(nullptr), smoothing_is_enabled(true), current_modulation_amount(0),
       current_value_state(HAS_NO_VALUE_STATE), current_modulation_state(HAS_NO_VALUE_STATE),
-      timeChanger(nullptr)
+      time_change_index(-1)
 {
 }
 
-COLD ParameterRuntimeInfo::~ParameterRuntimeInfo() noexcept
-{
-    if (timeChanger)
-    {
-        timeChanger->forceStopAndKill();
-        timeChanger = nullptr;
-    }
-}
+COLD ParameterRuntimeInfo::~ParameterRuntimeInfo() noexcept { stop_time_change(); }
 
 //==============================================================================
 //==============================================================================
@@ -243,57 +236,143 @@ COLD ArrayOfIntParameters::~ArrayOfIntParameters() noexcept
 //==============================================================================
 //==============================================================================
 //==============================================================================
-ChangeParamOverTime::ChangeParamOverTime(Parameter &param_, float target_value_,
-                                         int time_in_ms_) noexcept
-    : param(param_),
+ChangeParamOverTime *ChangeParamOverTime::instance = nullptr;
 
-      sum_callbacks(time_in_ms_ / PARAM_CHANGE_INTERVAL_IN_MS),
+COLD ChangeParamOverTime::ChangeParamOverTime() noexcept : num_ramps(0) { instance = this; }
+COLD ChangeParamOverTime::~ChangeParamOverTime() noexcept
+{
+    stopTimer();
+    for (int i = 0; i != num_ramps; ++i)
+    {
+        ramps[i].param->get_runtime_info().time_change_index = -1;
+    }
+    instance = nullptr;
+}
 
-      current_value(param_), target_value(target_value_),
-      value_delta((target_value_ - current_value) / sum_callbacks),
+//==============================================================================
+void ChangeParamOverTime::execute(Parameter &param_, float target_value_,
+                                  int time_in_ms_) noexcept
+{
+    if (instance == nullptr or not instance->start(param_, target_value_, time_in_ms_))
+    {
+        param_.set_value_by_automation(target_value_);
+    }
+}
 
-      min(param_.get_info().min_value), max(param_.get_info().max_value)
+bool ChangeParamOverTime::start(Parameter &param_, float target_value_, int time_in_ms_) noexcept
 {
-    ChangeParamOverTime *current_time_changer = param_.get_runtime_info().timeChanger;
-    if (current_time_changer != nullptr)
+    float first_value;
+    {
+        const SpinLock::ScopedLockType locked(lock);
+
+        // A RUNNING RAMP OF THE PARAM IS REPLACED IN ITS SLOT
+        ParameterRuntimeInfo &runtime_info = param_.get_runtime_info();
+        int index = runtime_info.time_change_index;
+        if (index == -1)
+        {
+            if (num_ramps == MAX_PARAM_CHANGES_OVER_TIME)
+            {
+                return false;
+            }
+            index = num_ramps++;
+            runtime_info.time_change_index = index;
+        }
+
+        Ramp &ramp = ramps[index];
+        ramp.param = &param_;
+        ramp.callbacks_left = jmax(1, time_in_ms_ / PARAM_CHANGE_INTERVAL_IN_MS);
+        ramp.current_value = param_.get_value();
+        ramp.target_value = target_value_;
+        ramp.value_delta = (target_value_ - ramp.current_value) / ramp.callbacks_left;
+        ramp.min = param_.get_info().min_value;
+        ramp.max = param_.get_info().max_value;
+
+        first_value = change(ramp);
+    }
+
+    if (not isTimerRunning())
     {
-        current_time_changer->forceStopAndKill();
+        startTimer(PARAM_CHANGE_INTERVAL_IN_MS);
     }
-    param_.get_runtime_info().timeChanger = this;
+    param_.set_value_by_automation(first_value);
 
-    change();
-    startTimer(PARAM_CHANGE_INTERVAL_IN_MS);
+    return true;
 }
-ChangeParamOverTime::~ChangeParamOverTime() noexcept {}
 
-void ChangeParamOverTime::timerCallback()
+void ChangeParamOverTime::stop(ParameterRuntimeInfo &runtime_info_) noexcept
 {
-    sum_callbacks--;
+    const SpinLock::ScopedLockType locked(lock);
+    if (runtime_info_.time_change_index != -1)
+    {
+        remove(runtime_info_.time_change_index);
+    }
+}
 
-    if (sum_callbacks > 0)
+// THE LAST RAMP TAKES THE FREE SLOT
+inline void ChangeParamOverTime::remove(int index_) noexcept
+{
+    ramps[index_].param->get_runtime_info().time_change_index = -1;
+    if (index_ != --num_ramps)
     {
-        change();
+        ramps[index_] = ramps[num_ramps];
+        ramps[index_].param->get_runtime_info().time_change_index = index_;
     }
-    else
+}
+
+//==============================================================================
+void ChangeParamOverTime::advance() noexcept
+{
+    int num_value_changes = 0;
     {
-        param.set_value_by_automation(target_value);
-        forceStopAndKill();
-        return;
+        const SpinLock::ScopedLockType locked(lock);
+
+        // BACKWARDS, remove() ONLY MOVES RAMPS WE HAVE ALREADY DONE
+        for (int i = num_ramps - 1; i >= 0; --i)
+        {
+            Ramp &ramp = ramps[i];
+            ValueChange &value_change = value_changes[num_value_changes++];
+            value_change.param = ramp.param;
+            if (--ramp.callbacks_left > 0)
+            {
+                value_change.value = change(ramp);
+            }
+            else
+            {
+                value_change.value = ramp.target_value;
+                remove(i);
+            }
+        }
+    }
+
+    // THE LISTENERS CAN START AND STOP RAMPS, SO WE SET THE VALUES WITHOUT THE LOCK
+    for (int i = 0; i != num_value_changes; ++i)
+    {
+        value_changes[i].param->set_value_by_automation(value_changes[i].value);
+    }
+}
+void ChangeParamOverTime::timerCallback()
+{
+    advance();
+
+    const SpinLock::ScopedLockType locked(lock);
+    if (num_ramps == 0)
+    {
+        stopTimer();
     }
 }
-inline void ChangeParamOverTime::change() noexcept
+inline float ChangeParamOverTime::change(Ramp &ramp_) noexcept
 {
-    current_value += value_delta;
-    if (current_value > max)
+    ramp_.current_value += ramp_.value_delta;
+    if (ramp_.current_value > ramp_.max)
     {
-        current_value = max;
+        ramp_.current_value = ramp_.max;
     }
-    else if (current_value < min)
+    else if (ramp_.current_value < ramp_.min)
     {
-        current_value = min;
+        ramp_.current_value = ramp_.min;
     }
 
-    param.set_value_by_automation(current_value);
+    return ramp_.current_value;
 }
 
 //==============================================================================
@@ -327,13 +406,18 @@ MIDIControl::~MIDIControl() {}
 
 void MIDIControl::clear()
 {
-    audio_processor->midi_control_handler->remove_trained(this);
+    MIDIControlHandler *const midi_control_handler = audio_processor->midi_control_handler;
+    const int last_midi_number = midi_number;
+
+    midi_control_handler->remove_trained(this);
     stop_listen_for_feedback();
     send_clear_feedback_only();
 
     audio_processor = nullptr;
     midi_number = -1;
     is_ctrl_version_of_name = "";
+
+    midi_control_handler->update_route(last_midi_number);
 }
 
 bool MIDIControl::read_from_if_you_listen(int controller_number_, int controller_value_,
@@ -444,6 +528,7 @@ bool MIDIControl::read_from_if_you_listen(int controller_number_, int controller
 bool MIDIControl::train(int controller_number_, Parameter *const is_ctrl_version_of_,
                         MoniqueAudioProcessor *audio_processor_) noexcept
 {
+    const int last_midi_number = midi_number;
     send_clear_feedback_only();
     audio_processor = audio_processor_;
 
@@ -473,12 +558,15 @@ bool MIDIControl::train(int controller_number_, Parameter *const is_ctrl_version
         stop_listen_for_feedback();
         audio_processor->midi_control_handler->remove_trained(this);
     }
+    audio_processor->midi_control_handler->update_route(last_midi_number);
+    audio_processor->midi_control_handler->update_route(midi_number);
 
     return success;
 }
 bool MIDIControl::train(int controller_number_, String is_ctrl_version_of_name_,
                         MoniqueAudioProcessor *audio_processor_) noexcept
 {
+    const int last_midi_number = midi_number;
     send_clear_feedback_only();
     audio_processor = audio_processor_;
 
@@ -496,6 +584,8 @@ bool MIDIControl::train(int controller_number_, String is_ctrl_version_of_name_,
         stop_listen_for_feedback();
         audio_processor->midi_control_handler->remove_trained(this);
     }
+    audio_processor->midi_control_handler->update_route(last_midi_number);
+    audio_processor->midi_control_handler->update_route(midi_number);
     return true;
 }
 
@@ -607,7 +697,8 @@ inline void MIDIControl::send_modulation_feedback() const noexcept
 // ==============================================================================
 COLD MIDIControlHandler::MIDIControlHandler(UiLookAndFeel *look_and_feel_,
                                             MoniqueAudioProcessor *const audio_processor_) noexcept
-    : ui_look_and_feel(look_and_feel_), audio_processor(audio_processor_)
+    : ui_look_and_feel(look_and_feel_), audio_processor(audio_processor_), routes(),
+      is_route_overflowed()
 {
     clear();
 }
@@ -663,6 +754,34 @@ void MIDIControlHandler::set_learn_param(Parameter *param_, Array<Component *> c
     }
 }
 Parameter *MIDIControlHandler::is_learning() const noexcept { return learning_param; }
+void MIDIControlHandler::update_route(int controller_number_) noexcept
+{
+    if (controller_number_ < 0 or controller_number_ >= MIDI_ROUTING_TABLE_SIZE)
+    {
+        return;
+    }
+
+    // THE AUDIO THREAD MAY READ THE ROUTE MEANWHILE, IT IS NEVER LONGER THAN ITS END MARK
+    MIDIControl **const route = routes[controller_number_];
+    int num_controls = 0;
+    for (int i = 0; i != trained_midi_ctrls_.size(); ++i)
+    {
+        MIDIControl *const midi_control = trained_midi_ctrls_.getUnchecked(i);
+        if (midi_control->midi_number == controller_number_)
+        {
+            if (num_controls < MAX_MIDI_CONTROLS_PER_ROUTE)
+            {
+                route[num_controls] = midi_control;
+            }
+            ++num_controls;
+        }
+    }
+    for (int i = num_controls; i <= MAX_MIDI_CONTROLS_PER_ROUTE; ++i)
+    {
+        route[i] = nullptr;
+    }
+    is_route_overflowed[controller_number_] = num_controls > MAX_MIDI_CONTROLS_PER_ROUTE;
+}
 bool MIDIControlHandler::handle_incoming_message(int controller_number_) noexcept
 {
     bool success = false;
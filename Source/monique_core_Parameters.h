@@ -11,6 +11,7 @@
 #define MONO_PARAMETER_H_INCLUDED
 
 #include "App.h"
+#include "monique_core_SIMD.h"
 
 // ==============================================================================
 // ==============================================================================
@@ -135,10 +136,10 @@ class ParameterRuntimeInfo
   private:
     // ==============================================================================
     friend class ChangeParamOverTime;
-    ChangeParamOverTime *timeChanger;
+    int time_change_index; // -1 IF THERE IS NO RAMP
 
   public:
-    inline void stop_time_change() const noexcept; // see below ChangeParamOverTime
+    inline void stop_time_change() noexcept; // see below ChangeParamOverTime
 
   private:
     // ==============================================================================
@@ -192,6 +193,8 @@ class Parameter
     // GETTER
     inline operator float() const noexcept { return value; }
     inline float get_value() const noexcept { return value; }
+    // FOR SNAPSHOTS, THE PARAM MUST NOT MOVE
+    inline const float *get_value_address() const noexcept { return &value; }
 
   protected:
     // ASSUME THE MEMORY GOES LINEAR FORWARD AND THE GETTER IS THE MOST USED FUNCTION
@@ -298,6 +301,11 @@ class Parameter
     // ==============================================================================
     // MODULATOR (OPTIONAL PARAMETER)
     inline float get_modulation_amount() const noexcept { return modulation_amount; }
+    // FOR SNAPSHOTS, THE PARAM MUST NOT MOVE
+    inline const float *get_modulation_amount_address() const noexcept
+    {
+        return &modulation_amount;
+    }
 
   protected:
     // MODULATION AMOUNT GOES MIN AND MAX FROM -1 to 1
@@ -894,60 +902,74 @@ class ArrayOfIntParameters
 //==============================================================================
 //==============================================================================
 #define PARAM_CHANGE_INTERVAL_IN_MS 20
-class ChangeParamOverTime
-    : public Timer // TODO TIME SLICED THREAD ( DONT START HUNDREDS OF TIMERS!)
-{
-    Parameter &param;
+#define MAX_PARAM_CHANGES_OVER_TIME 1024
+// ONE TIMER FOR THE PARAMETER RAMPS OF ALL INSTANCES. THE RAMPS LIVE IN A FIXED POOL, THE RUNNING
+// ONES PACKED AT ITS FRONT, AND EVERY PARAMETER KNOWS THE SLOT OF ITS RAMP. EACH MoniqueSynthData
+// HOLDS A SharedResourcePointer TO IT, WITHOUT ONE OR WITH A FULL POOL execute() SETS THE TARGET
+// AT ONCE.
+//
+// ANY THREAD CAN STOP A RAMP, THE POOL IS ONLY CHANGED UNDER THE SPIN LOCK AND THE VALUES ARE SET
+// AFTER IT IS RELEASED.
+class ChangeParamOverTime : public Timer
+{
+    struct Ramp
+    {
+        Parameter *param;
+        int callbacks_left;
+        float current_value;
+        float target_value;
+        float value_delta;
+        float min;
+        float max;
+    };
+    Ramp ramps[MAX_PARAM_CHANGES_OVER_TIME];
+    int num_ramps;
 
-    int sum_callbacks;
+    struct ValueChange
+    {
+        Parameter *param;
+        float value;
+    };
+    ValueChange value_changes[MAX_PARAM_CHANGES_OVER_TIME];
 
-    float current_value;
-    const float target_value;
-    const float value_delta;
-    const float min;
-    const float max;
+    SpinLock lock;
 
-    // ==============================================================================
-    ChangeParamOverTime(Parameter &param_, float target_value_, int time_in_ms_) noexcept;
-    ~ChangeParamOverTime() noexcept;
+    static ChangeParamOverTime *instance;
 
     // ==============================================================================
+    bool start(Parameter &param_, float target_value_, int time_in_ms_) noexcept;
+    void stop(ParameterRuntimeInfo &runtime_info_) noexcept;
+    inline void remove(int index_) noexcept;
+    inline float change(Ramp &ramp_) noexcept;
+
     void timerCallback() override;
-    inline void change() noexcept;
 
     friend class ParameterRuntimeInfo;
-    inline void forceStopAndKill() noexcept;
 
   public:
     // ==============================================================================
-    static inline void execute(Parameter &param_, float target_value_, int time_in_ms_) noexcept
-    {
-        new ChangeParamOverTime(param_, target_value_, time_in_ms_);
-    }
+    static void execute(Parameter &param_, float target_value_, int time_in_ms_) noexcept;
+
+    // ADVANCES EVERY RAMP BY ONE INTERVAL, THE TIMER CALLS IT EVERY PARAM_CHANGE_INTERVAL_IN_MS
+    void advance() noexcept;
+    int get_num_ramps() const noexcept { return num_ramps; }
+
+  public:
+    // ==============================================================================
+    COLD ChangeParamOverTime() noexcept;
+    COLD ~ChangeParamOverTime() noexcept;
 
   private:
     // ==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChangeParamOverTime)
 };
 
-inline void ChangeParamOverTime::forceStopAndKill() noexcept
-{
-    stopTimer();
-    if (param.get_runtime_info().timeChanger == this)
-    {
-        param.get_runtime_info().timeChanger = nullptr;
-    }
-
-    delete this;
-    return;
-}
-
 //==============================================================================
-inline void ParameterRuntimeInfo::stop_time_change() const noexcept
+inline void ParameterRuntimeInfo::stop_time_change() noexcept
 {
-    if (timeChanger)
+    if (time_change_index != -1 and ChangeParamOverTime::instance)
     {
-        timeChanger->forceStopAndKill();
+        ChangeParamOverTime::instance->stop(*this);
     }
 }
 
@@ -1359,6 +1381,10 @@ class MIDIControl : ParameterListener
 };
 
 class UiLookAndFeel;
+// THE CONTROLLER NUMBERS OF MoniqueSynthesizer::handleController, CC 0..127 OF THE FIRST CHANNEL
+// AND +128 FOR THE SECOND
+#define MIDI_ROUTING_TABLE_SIZE 256
+#define MAX_MIDI_CONTROLS_PER_ROUTE 8
 class MIDIControlHandler
 {
     UiLookAndFeel *const ui_look_and_feel;
@@ -1370,11 +1396,21 @@ class MIDIControlHandler
 
     Array<Component *> learning_comps;
     Array<MIDIControl *> trained_midi_ctrls_;
-    void add_trained(MIDIControl *midi_ctrl_) noexcept { trained_midi_ctrls_.add(midi_ctrl_); }
+    void add_trained(MIDIControl *midi_ctrl_) noexcept
+    {
+        trained_midi_ctrls_.addIfNotAlreadyThere(midi_ctrl_);
+    }
     void remove_trained(MIDIControl *midi_ctrl_) noexcept
     {
         trained_midi_ctrls_.removeFirstMatchingValue(midi_ctrl_);
     }
+
+    // THE TRAINED CONTROLS PER CONTROLLER NUMBER IN THE ORDER THEY WERE TRAINED, A ROUTE ENDS AT
+    // THE FIRST nullptr. MIDIControl::train AND clear REBUILD THE ROUTES THEY TOUCH, THE AUDIO
+    // THREAD ONLY READS THEM.
+    MIDIControl *routes[MIDI_ROUTING_TABLE_SIZE][MAX_MIDI_CONTROLS_PER_ROUTE + 1];
+    bool is_route_overflowed[MIDI_ROUTING_TABLE_SIZE];
+    void update_route(int controller_number_) noexcept;
     friend class MIDIControl;
     MIDIControl *get_trained(String &for_first_name_) noexcept
     {
@@ -1391,6 +1427,10 @@ class MIDIControlHandler
     }
 
   public:
+    // NULL TERMINATED, nullptr IF THERE ARE TOO MANY CONTROLS FOR THE TABLE AND THE CALLER HAS TO
+    // ASK ALL PARAMETERS
+    inline MIDIControl *const *get_route(int controller_number_) const noexcept;
+
     void toggle_midi_learn() noexcept;
     bool is_waiting_for_param() const noexcept;
     void set_learn_param(Parameter *param_) noexcept;
@@ -1417,6 +1457,20 @@ inline bool MIDIControlHandler::is_waiting_for_param() const noexcept
 {
     return is_activated_and_waiting_for_param;
 }
+inline MIDIControl *const *MIDIControlHandler::get_route(int controller_number_) const noexcept
+{
+    static MIDIControl *const empty_route[1] = {nullptr};
+    if (controller_number_ < 0 or controller_number_ >= MIDI_ROUTING_TABLE_SIZE)
+    {
+        return empty_route;
+    }
+    if (is_route_overflowed[controller_number_])
+    {
+        return nullptr;
+    }
+
+    return routes[controller_number_];
+}
 
 #include "monique_ui_LookAndFeel.h"
 #define IS_MIDI_LEARN                                                                              \
@@ -1518,7 +1572,53 @@ class LinearSmoother
 
         return lastValue;
     }
+    // BLOCK VERSION OF tick(), THE RAMP IS CALCULATED FROM ITS START (NOT SUMMED UP SAMPLE BY
+    // SAMPLE) AND RUNS IN SIMD LANES. RETURNS THE NUMBER OF SAMPLES THAT WERE STILL MOVING.
+    inline int process(float *dest_, int num_samples_) noexcept
+    {
+        int sid = 0;
+        if (countdown > 0)
+        {
+            const int num_ramp_samples = jmin(num_samples_, countdown - 1);
+            const float start = currentValue;
+            {
+                static const float offsets[MONO_SIMD_LANES] = {1, 2, 3, 4};
+                const mono_float4 steps = mono_float4::broadcast(step);
+                const mono_float4 first =
+                    mono_float4::broadcast(start) + mono_float4::load(offsets) * steps;
+                for (; sid <= num_ramp_samples - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+                {
+                    (first + steps * float(sid)).store(dest_ + sid);
+                }
+            }
+            for (; sid < num_ramp_samples; ++sid)
+            {
+                dest_[sid] = start + step * float(sid + 1);
+            }
+            currentValue = start + step * float(num_ramp_samples);
+            countdown -= num_ramp_samples;
+
+            // THE LAST STEP HITS THE TARGET
+            if (sid < num_samples_)
+            {
+                countdown = 0;
+                currentValue = target;
+                dest_[sid++] = target;
+            }
+            lastValue = currentValue;
+        }
+
+        const int num_moving_samples = sid;
+        if (sid < num_samples_)
+        {
+            FloatVectorOperations::fill(dest_ + sid, lastValue, num_samples_ - sid);
+        }
+
+        return num_moving_samples;
+    }
     inline bool is_up_to_date() const noexcept { return countdown == 0; }
+    // TICK() WILL NOT CHANGE THE VALUE ANYMORE
+    inline bool is_steady() const noexcept { return countdown < 1; }
     //==========================================================================
     inline float get_last_value() const noexcept { return lastValue; }
     inline float get_target_value() const noexcept { return target; }
@@ -1597,6 +1697,25 @@ template <int min = 0, int max = 1> class LinearSmootherMinMax : public LinearSm
 
         return lastValue;
     }
+    inline int process(float *dest_, int num_samples_) noexcept
+    {
+        const int num_moving_samples = LinearSmoother::process(dest_, num_samples_);
+        if (num_moving_samples > 0)
+        {
+            int sid = 0;
+            for (; sid <= num_samples_ - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+            {
+                simd_clamp(mono_float4::load(dest_ + sid), min, max).store(dest_ + sid);
+            }
+            for (; sid < num_samples_; ++sid)
+            {
+                dest_[sid] = jlimit(float(min), float(max), dest_[sid]);
+            }
+            lastValue = jlimit(float(min), float(max), lastValue);
+        }
+
+        return num_moving_samples;
+    }
 
     inline float glide_tick(float to_value) noexcept
     {
@@ -1,6 +1,7 @@
 #include "monique_core_Processor.h"
 
 #include "monique_core_Datastructures.h"
+#include "monique_core_RealtimeSanitizer.h"
 #include "monique_core_Synth.h"
 
 #include "monique_ui_MainWindow.h"
@@ -148,10 +149,13 @@ struct MoniqueAudioProcessor::standalone_features : public Timer
 
 COLD MoniqueAudioProcessor::MoniqueAudioProcessor() noexcept
     : mono_AudioDeviceManager(new RuntimeNotifyer()), stored_note(-1), stored_velocity(0),
-      samplePosition(0), lastBlockTime(0), peak_meter(nullptr), restore_time(-1),
+      ui_notes_lost(false), reset_pending_notes_requested(false), midi_input_notes_lost(false),
+      is_showing_midi_input(false), samplePosition(0), lastBlockTime(0),
+      peak_meter(nullptr), peak_meter_in_use(false), restore_time(-1),
       force_sample_rate_update(true), sampleReader(nullptr), amp_painter(nullptr)
 {
     SystemStats::setApplicationCrashHandler(&crash_handler);
+    ui_keyboard_state.addListener(this);
 
     scoped_shared_global_settings = get_shared_status();
     scoped_shared_ENV_clipboard = get_shared_ENV_clipboard();
@@ -676,6 +680,7 @@ if( audio_is_successful_initalized = (initialiseWithDefaultDevices(0,2) == "" ?
 
 COLD MoniqueAudioProcessor::~MoniqueAudioProcessor() noexcept
 {
+    ui_keyboard_state.removeListener(this);
     clear_feedback_and_shutdown();
 
     if (is_standalone())
@@ -715,13 +720,25 @@ COLD MoniqueAudioProcessor::~MoniqueAudioProcessor() noexcept
 //==============================================================================
 void MoniqueAudioProcessor::set_peak_meter(Monique_Ui_SegmentedMeter *peak_meter_) noexcept
 {
-    ScopedLock locked(peak_meter_lock);
-    peak_meter = peak_meter_;
+    peak_meter.store(peak_meter_);
 }
 void MoniqueAudioProcessor::clear_preak_meter() noexcept
 {
-    ScopedLock locked(peak_meter_lock);
-    peak_meter = nullptr;
+    peak_meter.store(nullptr);
+    while (peak_meter_in_use.load())
+    {
+        Thread::yield();
+    }
+}
+void MoniqueAudioProcessor::process_peak_meter(const float *samples_, int num_samples_) noexcept
+{
+    // SEQUENTIALLY CONSISTENT: EITHER clear_preak_meter SEES IT IN USE OR WE SEE THE nullptr
+    peak_meter_in_use.store(true);
+    if (Monique_Ui_SegmentedMeter *meter = peak_meter.load())
+    {
+        meter->process(samples_, num_samples_);
+    }
+    peak_meter_in_use.store(false);
 }
 
 //==============================================================================
@@ -738,10 +755,123 @@ void MoniqueAudioProcessor::processBlockBypassed(AudioSampleBuffer &buffer_,
     voice->bypass_smoother.set_value(false);
     process(buffer_, midi_messages_, true);
 }
-void MoniqueAudioProcessor::reset_pending_notes() { synth->reset_note_down_store(); }
+void MoniqueAudioProcessor::reset_pending_notes() { reset_pending_notes_requested.store(true); }
+void MoniqueAudioProcessor::ui_note_on(int channel_, int note_number_, float velocity_) noexcept
+{
+    if (not ui_note_events.push(UiNoteEvent{channel_, note_number_, jmax(velocity_, 0.0001f)}))
+    {
+        ui_notes_lost.store(true, std::memory_order_release);
+    }
+}
+void MoniqueAudioProcessor::ui_note_off(int channel_, int note_number_) noexcept
+{
+    if (not ui_note_events.push(UiNoteEvent{channel_, note_number_, 0}))
+    {
+        ui_notes_lost.store(true, std::memory_order_release);
+    }
+}
+void MoniqueAudioProcessor::handleNoteOn(MidiKeyboardState *, int midi_channel_, int note_number_,
+                                         float velocity_)
+{
+    if (not is_showing_midi_input)
+    {
+        ui_note_on(midi_channel_, note_number_, velocity_);
+    }
+}
+void MoniqueAudioProcessor::handleNoteOff(MidiKeyboardState *, int midi_channel_,
+                                          int note_number_, float)
+{
+    if (not is_showing_midi_input)
+    {
+        ui_note_off(midi_channel_, note_number_);
+    }
+}
+void MoniqueAudioProcessor::show_midi_input_on_keyboard() noexcept
+{
+    // THE KEYBOARD CALLS US BACK, THESE NOTES ARE ALREADY PLAYED
+    is_showing_midi_input = true;
+    if (midi_input_notes_lost.exchange(false, std::memory_order_acquire))
+    {
+        ui_keyboard_state.allNotesOff(0);
+    }
+    UiNoteEvent event;
+    while (midi_input_note_events.pop(event))
+    {
+        if (event.velocity > 0)
+        {
+            ui_keyboard_state.noteOn(event.channel, event.note_number, event.velocity);
+        }
+        else
+        {
+            ui_keyboard_state.noteOff(event.channel, event.note_number, 0);
+        }
+    }
+    is_showing_midi_input = false;
+}
+void MoniqueAudioProcessor::process_ui_requests(MidiBuffer &midi_messages_) noexcept
+{
+    if (reset_pending_notes_requested.exchange(false))
+    {
+        synth->reset_note_down_store();
+    }
+
+    // THE NOTES OF THE MIDI INPUT FOR THE ON SCREEN KEYBOARD, BEFORE WE ADD OUR OWN
+    {
+        MidiBuffer::Iterator message_iter(midi_messages_);
+        MidiMessage input_midi_message;
+        int sample_position;
+        while (message_iter.getNextEvent(input_midi_message, sample_position))
+        {
+            bool is_pushed = true;
+            if (input_midi_message.isNoteOn())
+            {
+                is_pushed = midi_input_note_events.push(
+                    UiNoteEvent{input_midi_message.getChannel(),
+                                input_midi_message.getNoteNumber(),
+                                input_midi_message.getFloatVelocity()});
+            }
+            else if (input_midi_message.isNoteOff())
+            {
+                is_pushed = midi_input_note_events.push(UiNoteEvent{
+                    input_midi_message.getChannel(), input_midi_message.getNoteNumber(), 0});
+            }
+            if (not is_pushed)
+            {
+                midi_input_notes_lost.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    // ALL NOTES OFF INSTEAD OF A LOST NOTE OFF, THE REST OF THE QUEUE IS DROPPED WITH IT
+    UiNoteEvent event;
+    if (ui_notes_lost.exchange(false, std::memory_order_acquire))
+    {
+        while (ui_note_events.pop(event))
+        {
+        }
+        synth->reset_note_down_store();
+        synth->allNotesOff(0, true);
+    }
+    while (ui_note_events.pop(event))
+    {
+        if (event.velocity > 0)
+        {
+            midi_messages_.addEvent(
+                MidiMessage::noteOn(event.channel, event.note_number, event.velocity), 0);
+        }
+        else
+        {
+            midi_messages_.addEvent(MidiMessage::noteOff(event.channel, event.note_number), 0);
+        }
+    }
+}
 void MoniqueAudioProcessor::process(AudioSampleBuffer &buffer_, MidiBuffer &midi_messages_,
                                     bool bypassed_)
 {
+    MONIQUE_REALTIME_SCOPE;
+    // FLUSH TO ZERO AND DENORMALS ARE ZERO (x86: MXCSR, ARM: FPCR) UNTIL THE BLOCK IS RENDERED
+    const ScopedNoDenormals no_denormals;
+
     if (is_standalone())
     {
         if (not standalone_features_pimpl->block_lock.tryEnter())
@@ -1060,7 +1190,7 @@ void MoniqueAudioProcessor::process(AudioSampleBuffer &buffer_, MidiBuffer &midi
                             .create_a_working_copy();
                     }
 
-                    MidiKeyboardState::processNextMidiBuffer(midi_messages_, 0, num_samples, true);
+                    process_ui_requests(midi_messages_);
 
                     const bool is_playing = current_pos_info.isPlaying;
                     if (was_playing and not is_playing)
@@ -3,6 +3,7 @@
 
 #include "App.h"
 #include "mono_AudioDeviceManager.h"
+#include "monique_core_LockFree.h"
 
 class MIDIControlHandler;
 class MoniqueSynthData;
@@ -15,9 +16,9 @@ class Monique_Ui_AmpPainter;
 class Monique_Ui_Mainwindow;
 
 class MoniqueAudioProcessor : public AudioProcessor,
-                              public MidiKeyboardState,
                               public mono_AudioDeviceManager,
-                              public ParameterListener
+                              public ParameterListener,
+                              private MidiKeyboardState::Listener
 {
     struct standalone_features;
     std::unique_ptr<standalone_features> standalone_features_pimpl;
@@ -38,13 +39,16 @@ class MoniqueAudioProcessor : public AudioProcessor,
 
     // ==============================================================================
     // UI
-  public:
-    Monique_Ui_SegmentedMeter *peak_meter;
-    CriticalSection peak_meter_lock;
+  private:
+    std::atomic<Monique_Ui_SegmentedMeter *> peak_meter;
+    std::atomic<bool> peak_meter_in_use;
 
   public:
     void set_peak_meter(Monique_Ui_SegmentedMeter *peak_meter_) noexcept;
+    // WAITS FOR A RUNNING process_peak_meter, THE METER CAN BE DELETED AFTER THIS
     void clear_preak_meter() noexcept;
+    // AUDIO THREAD
+    void process_peak_meter(const float *samples_, int num_samples_) noexcept;
 
   private:
     // ==============================================================================
@@ -63,8 +67,43 @@ class MoniqueAudioProcessor : public AudioProcessor,
     COLD void reset() override;
 
   public:
+    // THE NOTE DOWN STORE IS RESET BY THE NEXT BLOCK
     COLD void reset_pending_notes();
 
+    // NOTES FROM THE UI, PLAYED BY THE NEXT BLOCK
+    void ui_note_on(int channel_, int note_number_, float velocity_) noexcept;
+    void ui_note_off(int channel_, int note_number_) noexcept;
+
+    // THE STATE OF THE ON SCREEN KEYBOARD, ONLY THE MESSAGE THREAD TOUCHES IT. ITS NOTES GO TO
+    // ui_note_on AND ui_note_off.
+    MidiKeyboardState ui_keyboard_state;
+    // MESSAGE THREAD, SHOWS THE NOTES OF THE MIDI INPUT ON ui_keyboard_state
+    void show_midi_input_on_keyboard() noexcept;
+
+  private:
+    void handleNoteOn(MidiKeyboardState *, int midi_channel_, int note_number_,
+                      float velocity_) override;
+    void handleNoteOff(MidiKeyboardState *, int midi_channel_, int note_number_,
+                       float velocity_) override;
+
+    struct UiNoteEvent
+    {
+        int channel;
+        int note_number;
+        float velocity; // 0 IS A NOTE OFF
+    };
+    mono_SPSCQueue<UiNoteEvent, 64> ui_note_events;
+    // A FULL QUEUE MAY HAVE LOST A NOTE OFF, THE NEXT BLOCK STOPS ALL NOTES
+    std::atomic<bool> ui_notes_lost;
+    std::atomic<bool> reset_pending_notes_requested;
+    void process_ui_requests(MidiBuffer &midi_messages_) noexcept;
+
+    // THE OTHER WAY, AUDIO -> MESSAGE THREAD
+    mono_SPSCQueue<UiNoteEvent, 64> midi_input_note_events;
+    std::atomic<bool> midi_input_notes_lost;
+    bool is_showing_midi_input;
+
+  public:
     inline const AudioPlayHead::CurrentPositionInfo &get_current_pos_info() const noexcept
     {
         return current_pos_info;
@@ -0,0 +1,215 @@
+#include "monique_core_RealtimeSanitizer.h"
+
+#if MONIQUE_RT_SANITIZER
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <execinfo.h>
+#include <unistd.h>
+#define MONIQUE_RT_SANITIZER_BACKTRACE 1
+#endif
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <pthread.h>
+#define MONIQUE_RT_SANITIZER_LIBC_HOOKS 1
+#endif
+
+// NO DYNAMIC TLS, THE FIRST ACCESS MUST NOT ALLOCATE
+#if defined(__GNUC__)
+#define MONIQUE_RT_THREAD_LOCAL static __thread __attribute__((tls_model("initial-exec")))
+#else
+#define MONIQUE_RT_THREAD_LOCAL static thread_local
+#endif
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+MONIQUE_RT_THREAD_LOCAL int realtime_scope_depth = 0;
+MONIQUE_RT_THREAD_LOCAL bool is_reporting = false;
+
+static std::atomic<int> num_violations(0);
+
+#define MAX_STACK_FRAMES 32
+#define MAX_REPORTED_STACKS 1024
+static std::atomic<std::uint64_t> reported_stacks[MAX_REPORTED_STACKS];
+
+//==============================================================================
+// TRUE THE FIRST TIME A STACK IS SEEN, FALSE IF IT IS KNOWN OR THE TABLE IS FULL
+static bool is_new_stack(std::uint64_t hash_) noexcept
+{
+    hash_ = hash_ == 0 ? 1 : hash_;
+    for (int i = 0; i != MAX_REPORTED_STACKS; ++i)
+    {
+        std::atomic<std::uint64_t> &slot = reported_stacks[(hash_ + i) % MAX_REPORTED_STACKS];
+        std::uint64_t expected = 0;
+        if (slot.compare_exchange_strong(expected, hash_))
+        {
+            return true;
+        }
+        else if (expected == hash_)
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+static void report_violation(const char *what_) noexcept
+{
+    if (realtime_scope_depth == 0 or is_reporting)
+    {
+        return;
+    }
+
+    is_reporting = true;
+    ++num_violations;
+
+#if MONIQUE_RT_SANITIZER_BACKTRACE
+    void *frames[MAX_STACK_FRAMES];
+    const int num_frames = backtrace(frames, MAX_STACK_FRAMES);
+
+    // FNV-1a OF THE RETURN ADDRESSES
+    std::uint64_t hash = 14695981039346656037ull;
+    for (int i = 0; i != num_frames; ++i)
+    {
+        hash = (hash ^ std::uint64_t(reinterpret_cast<std::uintptr_t>(frames[i]))) *
+               1099511628211ull;
+    }
+
+    if (is_new_stack(hash))
+    {
+        std::fprintf(stderr, "MONIQUE RT SANITIZER: %s inside the audio callback\n", what_);
+        std::fflush(stderr);
+        // SKIP THE SANITIZER FRAMES
+        const int skip = num_frames > 2 ? 2 : 0;
+        backtrace_symbols_fd(frames + skip, num_frames - skip, STDERR_FILENO);
+    }
+#else
+    if (is_new_stack(reinterpret_cast<std::uintptr_t>(what_)))
+    {
+        std::fprintf(stderr, "MONIQUE RT SANITIZER: %s inside the audio callback\n", what_);
+    }
+#endif
+
+    is_reporting = false;
+}
+
+//==============================================================================
+RealtimeSanitizerScope::RealtimeSanitizerScope() noexcept { ++realtime_scope_depth; }
+RealtimeSanitizerScope::~RealtimeSanitizerScope() noexcept { --realtime_scope_depth; }
+
+RealtimeSanitizerExemption::RealtimeSanitizerExemption() noexcept
+    : realtime_scope_depth(::realtime_scope_depth)
+{
+    ::realtime_scope_depth = 0;
+}
+RealtimeSanitizerExemption::~RealtimeSanitizerExemption() noexcept
+{
+    ::realtime_scope_depth = realtime_scope_depth;
+}
+
+int get_num_realtime_violations() noexcept { return num_violations.load(); }
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+#if MONIQUE_RT_SANITIZER_LIBC_HOOKS
+// operator new AND delete OF LIBSTDC++ END UP HERE TOO
+extern "C" void *__libc_malloc(size_t);
+extern "C" void *__libc_calloc(size_t, size_t);
+extern "C" void *__libc_realloc(void *, size_t);
+extern "C" void *__libc_memalign(size_t, size_t);
+extern "C" void __libc_free(void *);
+
+extern "C" void *malloc(size_t size_)
+{
+    report_violation("malloc");
+    return __libc_malloc(size_);
+}
+extern "C" void *calloc(size_t num_, size_t size_)
+{
+    report_violation("calloc");
+    return __libc_calloc(num_, size_);
+}
+extern "C" void *realloc(void *ptr_, size_t size_)
+{
+    report_violation("realloc");
+    return __libc_realloc(ptr_, size_);
+}
+extern "C" int posix_memalign(void **ptr_, size_t alignment_, size_t size_)
+{
+    report_violation("posix_memalign");
+    *ptr_ = __libc_memalign(alignment_, size_);
+    return *ptr_ or size_ == 0 ? 0 : 12; // ENOMEM
+}
+extern "C" void *aligned_alloc(size_t alignment_, size_t size_)
+{
+    report_violation("aligned_alloc");
+    return __libc_memalign(alignment_, size_);
+}
+extern "C" void free(void *ptr_)
+{
+    if (ptr_)
+    {
+        report_violation("free");
+    }
+    __libc_free(ptr_);
+}
+
+//==============================================================================
+// CriticalSection, std::mutex AND THE SPIN LOCK FALLBACKS ALL LOCK THROUGH HERE
+extern "C" int pthread_mutex_lock(pthread_mutex_t *mutex_)
+{
+    typedef int (*lock_function)(pthread_mutex_t *);
+    static lock_function real_lock = nullptr;
+    if (real_lock == nullptr)
+    {
+        real_lock = reinterpret_cast<lock_function>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+    }
+
+    report_violation("pthread_mutex_lock");
+    return real_lock(mutex_);
+}
+
+#else
+//==============================================================================
+void *operator new(std::size_t size_)
+{
+    report_violation("operator new");
+    if (void *ptr = std::malloc(size_ ? size_ : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+void *operator new[](std::size_t size_) { return operator new(size_); }
+void *operator new(std::size_t size_, const std::nothrow_t &) noexcept
+{
+    report_violation("operator new");
+    return std::malloc(size_ ? size_ : 1);
+}
+void *operator new[](std::size_t size_, const std::nothrow_t &tag_) noexcept
+{
+    return operator new(size_, tag_);
+}
+void operator delete(void *ptr_) noexcept
+{
+    if (ptr_)
+    {
+        report_violation("operator delete");
+    }
+    std::free(ptr_);
+}
+void operator delete[](void *ptr_) noexcept { operator delete(ptr_); }
+void operator delete(void *ptr_, std::size_t) noexcept { operator delete(ptr_); }
+void operator delete[](void *ptr_, std::size_t) noexcept { operator delete(ptr_); }
+#endif
+
+#endif // MONIQUE_RT_SANITIZER
@@ -0,0 +1,51 @@
+#ifndef MONIQUE_CORE_REALTIMESANITIZER_H_INCLUDED
+#define MONIQUE_CORE_REALTIMESANITIZER_H_INCLUDED
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// REAL TIME SAFETY CHECKS, BUILT WITH -DMONIQUE_RT_SANITIZER=ON
+//
+// WHILE A MONIQUE_REALTIME_SCOPE IS ALIVE ON A THREAD, EVERY ALLOCATION, FREE AND MUTEX LOCK OF
+// THIS THREAD IS A VIOLATION. EACH VIOLATION IS COUNTED AND REPORTED WITH ITS STACK TRACE TO
+// STDERR, EVERY STACK ONLY ONCE.
+//
+// MALLOC AND MUTEX HOOKS NEED GLIBC, OTHER PLATFORMS ONLY TRAP operator new AND delete. THE HOOKS
+// ARE RELIABLE IN THE HEADLESS TOOLS ONLY, IN A PLUGIN THE ALLOCATOR OF THE HOST WINS.
+//==============================================================================
+#if MONIQUE_RT_SANITIZER
+class RealtimeSanitizerScope
+{
+  public:
+    RealtimeSanitizerScope() noexcept;
+    ~RealtimeSanitizerScope() noexcept;
+
+  private:
+    RealtimeSanitizerScope(const RealtimeSanitizerScope &) = delete;
+    RealtimeSanitizerScope &operator=(const RealtimeSanitizerScope &) = delete;
+};
+
+// A WANTED LOCK INSIDE THE SCOPE, E.G. WAKING PARKED WORKER THREADS
+class RealtimeSanitizerExemption
+{
+    int realtime_scope_depth;
+
+  public:
+    RealtimeSanitizerExemption() noexcept;
+    ~RealtimeSanitizerExemption() noexcept;
+
+  private:
+    RealtimeSanitizerExemption(const RealtimeSanitizerExemption &) = delete;
+    RealtimeSanitizerExemption &operator=(const RealtimeSanitizerExemption &) = delete;
+};
+
+int get_num_realtime_violations() noexcept;
+
+#define MONIQUE_REALTIME_SCOPE RealtimeSanitizerScope realtime_sanitizer_scope
+#define MONIQUE_REALTIME_EXEMPTION RealtimeSanitizerExemption realtime_sanitizer_exemption
+#else
+#define MONIQUE_REALTIME_SCOPE
+#define MONIQUE_REALTIME_EXEMPTION
+#endif
+
+#endif // MONIQUE_CORE_REALTIMESANITIZER_H_INCLUDED
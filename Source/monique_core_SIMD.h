@@ -0,0 +1,300 @@
+#ifndef MONIQUE_CORE_SIMD_H_INCLUDED
+#define MONIQUE_CORE_SIMD_H_INCLUDED
+
+#include <cmath>
+#include <cstdint>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// FOUR FLOATS IN ONE REGISTER: SSE2 ON X86, NEON ON ARM64 AND PLAIN FLOATS ELSEWHERE.
+// MONO_SIMD_DISABLE FORCES THE PLAIN VERSION.
+#if !defined(MONO_SIMD_DISABLE) &&                                                               \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define MONO_SIMD_SSE 1
+#elif !defined(MONO_SIMD_DISABLE) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define MONO_SIMD_NEON 1
+#endif
+
+#define MONO_SIMD_LANES 4
+
+struct mono_float4
+{
+#if MONO_SIMD_SSE
+    __m128 v;
+#elif MONO_SIMD_NEON
+    float32x4_t v;
+#else
+    float v[MONO_SIMD_LANES];
+#endif
+
+    //==========================================================================
+    static inline mono_float4 load(const float *source_) noexcept
+    {
+        mono_float4 r;
+#if MONO_SIMD_SSE
+        r.v = _mm_loadu_ps(source_);
+#elif MONO_SIMD_NEON
+        r.v = vld1q_f32(source_);
+#else
+        for (int i = 0; i != MONO_SIMD_LANES; ++i)
+        {
+            r.v[i] = source_[i];
+        }
+#endif
+        return r;
+    }
+    inline void store(float *dest_) const noexcept
+    {
+#if MONO_SIMD_SSE
+        _mm_storeu_ps(dest_, v);
+#elif MONO_SIMD_NEON
+        vst1q_f32(dest_, v);
+#else
+        for (int i = 0; i != MONO_SIMD_LANES; ++i)
+        {
+            dest_[i] = v[i];
+        }
+#endif
+    }
+    static inline mono_float4 broadcast(float value_) noexcept
+    {
+        mono_float4 r;
+#if MONO_SIMD_SSE
+        r.v = _mm_set1_ps(value_);
+#elif MONO_SIMD_NEON
+        r.v = vdupq_n_f32(value_);
+#else
+        for (int i = 0; i != MONO_SIMD_LANES; ++i)
+        {
+            r.v[i] = value_;
+        }
+#endif
+        return r;
+    }
+    inline float get(int lane_) const noexcept
+    {
+        float values[MONO_SIMD_LANES];
+        store(values);
+        return values[lane_];
+    }
+};
+
+//==============================================================================
+#if MONO_SIMD_SSE
+#define MONO_SIMD_OPERATOR(op, sse_, neon_)                                                        \
+    static inline mono_float4 operator op(mono_float4 a_, mono_float4 b_) noexcept                \
+    {                                                                                              \
+        mono_float4 r;                                                                             \
+        r.v = sse_(a_.v, b_.v);                                                                    \
+        return r;                                                                                  \
+    }
+#elif MONO_SIMD_NEON
+#define MONO_SIMD_OPERATOR(op, sse_, neon_)                                                        \
+    static inline mono_float4 operator op(mono_float4 a_, mono_float4 b_) noexcept                \
+    {                                                                                              \
+        mono_float4 r;                                                                             \
+        r.v = neon_(a_.v, b_.v);                                                                   \
+        return r;                                                                                  \
+    }
+#else
+#define MONO_SIMD_OPERATOR(op, sse_, neon_)                                                        \
+    static inline mono_float4 operator op(mono_float4 a_, mono_float4 b_) noexcept                \
+    {                                                                                              \
+        mono_float4 r;                                                                             \
+        for (int i = 0; i != MONO_SIMD_LANES; ++i)                                                 \
+        {                                                                                          \
+            r.v[i] = a_.v[i] op b_.v[i];                                                           \
+        }                                                                                          \
+        return r;                                                                                  \
+    }
+#endif
+MONO_SIMD_OPERATOR(+, _mm_add_ps, vaddq_f32)
+MONO_SIMD_OPERATOR(-, _mm_sub_ps, vsubq_f32)
+MONO_SIMD_OPERATOR(*, _mm_mul_ps, vmulq_f32)
+MONO_SIMD_OPERATOR(/, _mm_div_ps, vdivq_f32)
+#undef MONO_SIMD_OPERATOR
+
+static inline mono_float4 operator*(mono_float4 a_, float b_) noexcept
+{
+    return a_ * mono_float4::broadcast(b_);
+}
+static inline mono_float4 operator+(mono_float4 a_, float b_) noexcept
+{
+    return a_ + mono_float4::broadcast(b_);
+}
+static inline mono_float4 operator-(mono_float4 a_, float b_) noexcept
+{
+    return a_ - mono_float4::broadcast(b_);
+}
+
+//==============================================================================
+static inline mono_float4 simd_min(mono_float4 a_, mono_float4 b_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_min_ps(a_.v, b_.v);
+#elif MONO_SIMD_NEON
+    r.v = vminq_f32(a_.v, b_.v);
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = a_.v[i] < b_.v[i] ? a_.v[i] : b_.v[i];
+    }
+#endif
+    return r;
+}
+static inline mono_float4 simd_max(mono_float4 a_, mono_float4 b_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_max_ps(a_.v, b_.v);
+#elif MONO_SIMD_NEON
+    r.v = vmaxq_f32(a_.v, b_.v);
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = a_.v[i] > b_.v[i] ? a_.v[i] : b_.v[i];
+    }
+#endif
+    return r;
+}
+static inline mono_float4 simd_clamp(mono_float4 x_, float min_, float max_) noexcept
+{
+    return simd_min(simd_max(x_, mono_float4::broadcast(min_)), mono_float4::broadcast(max_));
+}
+static inline mono_float4 simd_abs(mono_float4 x_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_andnot_ps(_mm_set1_ps(-0.0f), x_.v);
+#elif MONO_SIMD_NEON
+    r.v = vabsq_f32(x_.v);
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = std::fabs(x_.v[i]);
+    }
+#endif
+    return r;
+}
+// THE MAGNITUDE OF magnitude_ WITH THE SIGN OF sign_
+static inline mono_float4 simd_copy_sign(mono_float4 magnitude_, mono_float4 sign_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    r.v = _mm_or_ps(_mm_andnot_ps(sign_mask, magnitude_.v), _mm_and_ps(sign_mask, sign_.v));
+#elif MONO_SIMD_NEON
+    r.v = vbslq_f32(vdupq_n_u32(0x80000000u), sign_.v, magnitude_.v);
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = std::copysign(magnitude_.v[i], sign_.v[i]);
+    }
+#endif
+    return r;
+}
+// THE SUM OF ALL LANES
+static inline float simd_sum(mono_float4 x_) noexcept
+{
+#if MONO_SIMD_NEON
+    return vaddvq_f32(x_.v);
+#else
+    float values[MONO_SIMD_LANES];
+    x_.store(values);
+    return (values[0] + values[1]) + (values[2] + values[3]);
+#endif
+}
+//==============================================================================
+// MASKS ARE mono_float4 TOO: ALL BITS SET PER TRUE LANE (1.0f IN THE PLAIN VERSION)
+static inline mono_float4 simd_greater(mono_float4 a_, mono_float4 b_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_cmpgt_ps(a_.v, b_.v);
+#elif MONO_SIMD_NEON
+    r.v = vreinterpretq_f32_u32(vcgtq_f32(a_.v, b_.v));
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = a_.v[i] > b_.v[i] ? 1.0f : 0.0f;
+    }
+#endif
+    return r;
+}
+static inline mono_float4 simd_not_zero(mono_float4 x_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_cmpneq_ps(x_.v, _mm_setzero_ps());
+#elif MONO_SIMD_NEON
+    r.v = vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(x_.v, vdupq_n_f32(0))));
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = x_.v[i] != 0 ? 1.0f : 0.0f;
+    }
+#endif
+    return r;
+}
+static inline mono_float4 simd_or(mono_float4 mask_a_, mono_float4 mask_b_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_or_ps(mask_a_.v, mask_b_.v);
+#elif MONO_SIMD_NEON
+    r.v = vreinterpretq_f32_u32(
+        vorrq_u32(vreinterpretq_u32_f32(mask_a_.v), vreinterpretq_u32_f32(mask_b_.v)));
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = (mask_a_.v[i] != 0 or mask_b_.v[i] != 0) ? 1.0f : 0.0f;
+    }
+#endif
+    return r;
+}
+// PER LANE mask_ ? if_true_ : if_false_
+static inline mono_float4 simd_select(mono_float4 mask_, mono_float4 if_true_,
+                                      mono_float4 if_false_) noexcept
+{
+    mono_float4 r;
+#if MONO_SIMD_SSE
+    r.v = _mm_or_ps(_mm_and_ps(mask_.v, if_true_.v), _mm_andnot_ps(mask_.v, if_false_.v));
+#elif MONO_SIMD_NEON
+    r.v = vbslq_f32(vreinterpretq_u32_f32(mask_.v), if_true_.v, if_false_.v);
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        r.v[i] = mask_.v[i] != 0 ? if_true_.v[i] : if_false_.v[i];
+    }
+#endif
+    return r;
+}
+static inline bool simd_any(mono_float4 mask_) noexcept
+{
+#if MONO_SIMD_SSE
+    return _mm_movemask_ps(mask_.v) != 0;
+#elif MONO_SIMD_NEON
+    return vmaxvq_u32(vreinterpretq_u32_f32(mask_.v)) != 0;
+#else
+    for (int i = 0; i != MONO_SIMD_LANES; ++i)
+    {
+        if (mask_.v[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+// PER LANE a_ > b_ ? if_true_ : if_false_
+static inline mono_float4 simd_select_greater(mono_float4 a_, mono_float4 b_, mono_float4 if_true_,
+                                              mono_float4 if_false_) noexcept
+{
+    return simd_select(simd_greater(a_, b_), if_true_, if_false_);
+}
+
+#endif // MONIQUE_CORE_SIMD_H_INCLUDED
@@ -1,6 +1,8 @@
 
 #include "monique_core_Synth.h"
 #include "monique_core_Datastructures.h"
+#include "monique_core_FastMath.h"
+#include "monique_core_WorkerPool.h"
 
 #include "monique_ui_AmpPainter.h"
 #include "monique_core_Processor.h"
@@ -28,16 +30,22 @@ static inline float sample_mix(float s1_, float s2_) noexcept
 
     return s1_;
 }
+// SAME AS ABOVE PER LANE: THE PRODUCT IS POSITIVE IF BOTH HAVE THE SAME SIGN
+static inline mono_float4 sample_mix(mono_float4 s1_, mono_float4 s2_) noexcept
+{
+    const mono_float4 product = s1_ * s2_;
+    const mono_float4 zero = mono_float4::broadcast(0);
+
+    return (s1_ + s2_) - simd_select_greater(product, zero, simd_copy_sign(product, s1_), zero);
+}
 
 //==============================================================================
 //==============================================================================
 //==============================================================================
-// TOOPT WITH TABLE LOCKUP
 #define left_pan(pan_, sin_lookup_)                                                                \
-    jmax((float)std::sin(((pan_ + 1) * 0.5) * (float_Pi * 0.5f)), 0.00001f)
-// TOOPT WITH TABLE LOCKUP
+    jmax(lookup(sin_lookup_, ((pan_ + 1) * 0.5f) * (float_Pi * 0.5f)), 0.00001f)
 #define right_pan(pan_, cos_lookup_)                                                               \
-    jmax((float)std::cos(((pan_ + 1) * 0.5) * (float_Pi * 0.5f)), 0.00001f)
+    jmax(lookup(cos_lookup_, ((pan_ + 1) * 0.5f) * (float_Pi * 0.5f)), 0.00001f)
 
 //==============================================================================
 //==============================================================================
@@ -56,11 +64,16 @@ COLD SmoothedParameter::SmoothedParameter(SmoothManager *const smooth_manager_,
 
       values(block_size), modulation_power(block_size),
 
+      values_are_constant(false), constant_value(0), modulation_is_constant(false),
+      constant_modulation(0), smooth_motor_time_in_ms(-1),
+
       param_to_smooth(param_to_smooth_),
 
       max_value(param_to_smooth_->get_info().max_value),
       min_value(param_to_smooth_->get_info().min_value),
 
+      snapshot(nullptr), value_offset(0), modulation_offset(0),
+
       simple_smoother(0.001), left_morph_smoother(0.001), right_morph_smoother(0.001),
       left_modulation_morph_smoother(0.001), right_modulation_morph_smoother(0.001),
       morph_power_smoother(0.001), modulation_power_smoother(0.001), amp_power_smoother(0.001)
@@ -88,12 +101,27 @@ COLD void SmoothedParameter::set_offline() noexcept
         smooth_manager->smoothers.removeFirstMatchingValue(this);
     }
 }
+COLD void SmoothManager::register_values(mono_ParameterSnapshot *snapshot_) noexcept
+{
+    for (int i = 0; i != smoothers.size(); ++i)
+    {
+        SmoothedParameter *const smoother = smoothers.getUnchecked(i);
+        smoother->value_offset =
+            snapshot_->add_value(smoother->param_to_smooth->get_value_address());
+        smoother->modulation_offset =
+            snapshot_->add_value(smoother->param_to_smooth->get_modulation_amount_address());
+        smoother->snapshot = snapshot_;
+    }
+}
 
 //==============================================================================
 COLD void SmoothedParameter::sample_rate_or_block_changed() noexcept
 {
     values.setSize(block_size);
     modulation_power.setSize(block_size);
+    values_are_constant = false;
+    modulation_is_constant = false;
+    smooth_motor_time_in_ms = -1;
 
     simple_smoother.set_value(morph_power_smoother.get_last_value());
     simple_smoother.reset_coefficients(sample_rate, 0);
@@ -222,16 +250,73 @@ class Smoother : RuntimeListener
 //==============================================================================
 //==============================================================================
 // TOOPT with AudioBuffer and Function
-// atan lookup???
 static inline float soft_clipping(float input_and_worker_) noexcept
 {
-    return (std::atan(input_and_worker_) * (1.0f / float_Pi)) * 1.5;
+    return (fast_atan(input_and_worker_) * (1.0f / float_Pi)) * 1.5f;
+}
+static inline mono_float4 soft_clipping(mono_float4 input_and_worker_) noexcept
+{
+    return fast_atan(input_and_worker_) * (1.5f / float_Pi);
 }
 
 //==============================================================================
 // TOOPT with AudioBuffer and Function
 static inline float lfo2amp(float sample_) noexcept { return (sample_ + 1.0f) * 0.5f; }
 
+//==============================================================================
+// CONTROL RATE: source_.value_at( sid ) IS ONLY EVALUATED EVERY control_rate_ SAMPLES AND AT THE
+// LAST SAMPLE, THE SAMPLES BETWEEN ARE INTERPOLATED FROM start_value_ (THE SAMPLE BEFORE THE BLOCK)
+// ON. CUBIC (CATMULL-ROM) EVALUATES ONE MORE POINT BEFORE AND BEHIND THE BLOCK (AND THE LAST
+// STEP), SO value_at HAS TO HANDLE POSITIONS OUTSIDE OF IT. ALL MODULATION SOURCES ARE 0...1.
+template <class source_type>
+static inline void render_at_control_rate(float *dest_, int num_samples_, int control_rate_,
+                                          bool is_cubic_, float start_value_,
+                                          const source_type &source_) noexcept
+{
+    float before = is_cubic_ ? source_.value_at(-1 - control_rate_) : start_value_;
+    float start = start_value_;
+    float behind = 0;
+    int behind_pos = -1;
+    for (int start_pos = -1; start_pos < num_samples_ - 1;)
+    {
+        const int end_pos = jmin(start_pos + control_rate_, num_samples_ - 1);
+        const int num_steps = end_pos - start_pos;
+        const float step = 1.0f / num_steps;
+        const float end = behind_pos == end_pos ? behind : source_.value_at(end_pos);
+        if (is_cubic_)
+        {
+            // THE LAST STEP CAN BE SHORTER, ITS OUTER POINTS NEED THE SAME DISTANCE
+            if (num_steps != control_rate_)
+            {
+                before = source_.value_at(start_pos - num_steps);
+            }
+            behind_pos = end_pos + num_steps;
+            behind = source_.value_at(behind_pos);
+            const float c1 = end - before;
+            const float c2 = 2.0f * before - 5.0f * start + 4.0f * end - behind;
+            const float c3 = 3.0f * (start - end) + behind - before;
+            for (int i = 1; i <= num_steps; ++i)
+            {
+                const float t = i * step;
+                dest_[start_pos + i] =
+                    jlimit(0.0f, 1.0f, start + 0.5f * t * (c1 + t * (c2 + t * c3)));
+            }
+        }
+        else
+        {
+            const float delta = (end - start) * step;
+            for (int i = 1; i <= num_steps; ++i)
+            {
+                dest_[start_pos + i] = start + delta * i;
+            }
+        }
+
+        before = start;
+        start = end;
+        start_pos = end_pos;
+    }
+}
+
 //==============================================================================
 static inline float distortion(float input_and_worker_, float distortion_power_) noexcept
 {
@@ -290,6 +375,15 @@ static inline float soft_clipp_greater_1_2(float x) noexcept
 
     return x;
 }
+static inline mono_float4 soft_clipp_greater_1_2(mono_float4 x) noexcept
+{
+    const mono_float4 one = mono_float4::broadcast(1);
+    const mono_float4 minus_one = mono_float4::broadcast(-1);
+    x = simd_select_greater(x, one, soft_clipping(x - 1.0f) + 1.0f, x);
+    x = simd_select_greater(minus_one, x, soft_clipping(x + 1.0f) - 1.0f, x);
+
+    return simd_clamp(x, -1.2f, 1.2f);
+}
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -334,81 +428,93 @@ static inline float hard_clipper_1(float x) noexcept
 
     return x;
 }
+static inline mono_float4 hard_clipper_1(mono_float4 x) noexcept { return simd_clamp(x, -1, 1); }
 
 //==============================================================================
 //==============================================================================
 //==============================================================================
-// replace with juce table lookup
+// LINEAR INTERPOLATED, x WRAPS AT 2*PI IN BOTH DIRECTIONS
 static float inline lookup(const float *table_, float x) noexcept
 {
-    return table_[int(x * TABLESIZE_MULTI) % LOOKUP_TABLE_SIZE];
+    const float position = x * float(LOOKUP_TABLE_SCALE);
+    const int truncated = int(position);
+    const int index = truncated - (position < truncated); // FLOOR
+    const float fraction = position - index;
+    const float *const values = table_ + (index & LOOKUP_TABLE_MASK);
+
+    return values[0] + fraction * (values[1] - values[0]);
+}
+// BLOCK VERSION, dest_ MAY BE angles_
+static void inline lookup(const float *table_, const float *angles_, float *dest_,
+                          int num_samples_) noexcept
+{
+    for (int sid = 0; sid != num_samples_; ++sid)
+    {
+        dest_[sid] = lookup(table_, angles_[sid]);
+    }
 }
 //==============================================================================
 COLD DataBuffer::DataBuffer(int init_buffer_size_) noexcept
-    : size(init_buffer_size_),
+    : size(0), arena(nullptr), capacity(0)
+{
+    resize_buffer_if_required(init_buffer_size_);
+}
+COLD DataBuffer::~DataBuffer() noexcept {}
 
-      band_env_buffers(init_buffer_size_), band_out_buffers(init_buffer_size_),
+//==============================================================================
+int DataBuffer::place_buffers(float *arena_, int channel_stride_) noexcept
+{
+    int offset = 0;
+    offset = velocity_buffer.place(arena_, offset, size, channel_stride_);
 
-      lfo_amplitudes(init_buffer_size_), mfo_amplitudes(init_buffer_size_),
-      filter_output_samples_l_r(init_buffer_size_), filter_stereo_output_samples(init_buffer_size_),
+    offset = mfo_amplitudes.place(arena_, offset, size, channel_stride_);
+    offset = lfo_amplitudes.place(arena_, offset, size, channel_stride_);
 
-      osc_samples(init_buffer_size_), osc_switchs(init_buffer_size_),
-      osc_sync_switchs(init_buffer_size_), modulator_samples(init_buffer_size_),
+    offset = osc_samples.place(arena_, offset, size, channel_stride_);
+    offset = osc_switchs.place(arena_, offset, size, channel_stride_);
+    offset = osc_sync_switchs.place(arena_, offset, size, channel_stride_);
+    offset = modulator_samples.place(arena_, offset, size, channel_stride_);
 
-      final_env(init_buffer_size_),
+    offset = filter_env_amps.place(arena_, offset, size, channel_stride_);
 #ifdef POLY
-      filter_env_tracking(init_buffer_size_),
+    offset = filter_env_tracking.place(arena_, offset, size, channel_stride_);
 #endif
-      chorus_env(init_buffer_size_),
+    offset = filter_input_env_amps.place(arena_, offset, size, channel_stride_);
+    offset = filter_input_samples.place(arena_, offset, size, channel_stride_);
+    offset = filter_output_samples.place(arena_, offset, size, channel_stride_);
+    offset = filter_output_samples_l_r.place(arena_, offset, size, channel_stride_);
+    offset = filter_stereo_output_samples.place(arena_, offset, size, channel_stride_);
 
-      filter_input_samples(init_buffer_size_), filter_input_env_amps(init_buffer_size_),
-      filter_output_samples(init_buffer_size_), filter_env_amps(init_buffer_size_),
+    offset = band_env_buffers.place(arena_, offset, size, channel_stride_);
+    offset = band_out_buffers.place(arena_, offset, size, channel_stride_);
 
-      tmp_buffer(init_buffer_size_),
+    offset = chorus_env.place(arena_, offset, size, channel_stride_);
+    offset = final_env.place(arena_, offset, size, channel_stride_);
 
-      second_mono_buffer(init_buffer_size_),
+    offset = tmp_buffer.place(arena_, offset, size, channel_stride_);
+    offset = second_mono_buffer.place(arena_, offset, size, channel_stride_);
 
-      velocity_buffer(init_buffer_size_)
-{
+    return offset;
 }
-COLD DataBuffer::~DataBuffer() noexcept {}
-
-//==============================================================================
 COLD void DataBuffer::resize_buffer_if_required(int size_) noexcept
 {
     if (size_ != size)
     {
         size = size_;
 
-        band_env_buffers.setSize(size_);
-        band_out_buffers.setSize(size_);
-
-        lfo_amplitudes.setSize(size_);
-        mfo_amplitudes.setSize(size_);
-        filter_stereo_output_samples.setSize(size_);
-        filter_output_samples_l_r.setSize(size_);
-
-        osc_samples.setSize(size_);
-        osc_switchs.setSize(size_);
-        osc_sync_switchs.setSize(size_);
-        modulator_samples.setSize(size_);
-
-        final_env.setSize(size_);
-#ifdef POLY
-        filter_env_tracking.setSize(size_);
-#endif
-        chorus_env.setSize(size_);
-
-        filter_input_samples.setSize(size_);
-        filter_input_env_amps.setSize(size_);
-        filter_output_samples.setSize(size_);
-        filter_env_amps.setSize(size_);
-
-        tmp_buffer.setSize(size_);
-
-        second_mono_buffer.setSize(size_);
+        // 16 FLOATS ARE ONE CACHE LINE
+        const int channel_stride = (jmax(size_, capacity) + DEBUG_BUFFER_SIDE_OFFSET + 15) & ~15;
+        const int num_floats = place_buffers(nullptr, channel_stride);
+        if (size_ > capacity)
+        {
+            capacity = size_;
+            arena_memory.allocate(num_floats * sizeof(float) + 63, false);
+            arena = reinterpret_cast<float *>(
+                (reinterpret_cast<std::uintptr_t>(arena_memory.get()) + 63) & ~std::uintptr_t(63));
+        }
 
-        velocity_buffer.setSize(size_);
+        FloatVectorOperations::clear(arena, num_floats);
+        place_buffers(arena, channel_stride);
     }
 }
 
@@ -521,6 +627,9 @@ class mono_BlitSaw
     unsigned int m_;
 
   public:
+    // INTEGRATES, NEEDS EVERY SAMPLE
+    static constexpr bool is_stateless = false;
+
     //==========================================================================
     inline float tick(double phase_) noexcept
     {
@@ -603,6 +712,9 @@ class mono_BlitSquare
     unsigned int m_;
 
   public:
+    // INTEGRATES, NEEDS EVERY SAMPLE
+    static constexpr bool is_stateless = false;
+
     //==========================================================================
     inline float tick(double phase_) noexcept
     {
@@ -681,6 +793,134 @@ class mono_BlitSquare
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_BlitSquare)
 };
 
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// POLYBLEP GENERATORS
+//
+// NAIVE WAVES WITH A TWO SAMPLE POLYNOMIAL CORRECTION AT THE STEPS. SAME INTERFACE, LEVEL,
+// POLARITY AND PHASE AS THE BLIT GENERATORS ABOVE, BUT WITHOUT ANY sin() PER SAMPLE. THEY HAVE
+// NO STATE AND CAN BE SKIPPED WHILE THEY ARE NOT AUDIBLE.
+static inline double poly_blep(double t_, double dt_) noexcept
+{
+    if (t_ < dt_)
+    {
+        t_ /= dt_;
+        return t_ + t_ - t_ * t_ - 1;
+    }
+    else if (t_ > 1.0 - dt_)
+    {
+        t_ = (t_ - 1.0) / dt_;
+        return t_ * t_ + t_ + t_ + 1;
+    }
+
+    return 0;
+}
+static inline double wrap_cycle(double cycle_) noexcept { return cycle_ - std::floor(cycle_); }
+
+//==============================================================================
+class mono_PolyBLEPSaw
+{
+    float last_tick_value;
+    float phase_offset;
+    double dt;
+
+  public:
+    static constexpr bool is_stateless = true;
+
+    //==========================================================================
+    // PHASE: 0 - PI PER CYCLE, LIKE THE BLIT SAW
+    inline float tick(double phase_) noexcept
+    {
+        const double t = wrap_cycle(phase_ * (1.0 / double_Pi) + phase_offset);
+        return last_tick_value = 0.5 - t + 0.5 * poly_blep(t, dt);
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    inline void set_phase_offset(float offset_) noexcept { phase_offset = offset_; }
+    inline void updateHarmonics(double p) noexcept { dt = jmin(0.5, 1.0 / p); }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+  public:
+    //==========================================================================
+    COLD mono_PolyBLEPSaw() noexcept : last_tick_value(0), phase_offset(0), dt(0.5) {}
+    COLD ~mono_PolyBLEPSaw() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_PolyBLEPSaw)
+};
+
+//==============================================================================
+class mono_PolyBLEPSquare
+{
+    float last_tick_value;
+    float phase_offset;
+    double dt;
+
+  public:
+    static constexpr bool is_stateless = true;
+
+    //==========================================================================
+    // ANGLE: 0 - 2*PI PER CYCLE, LIKE THE BLIT SQUARE
+    inline float tick(double angle_) noexcept
+    {
+        const double t = wrap_cycle(angle_ * (0.5 / double_Pi) + phase_offset);
+        const double naive = t < 0.5 ? 0.5 : -0.5;
+        return last_tick_value =
+                   naive + 0.5 * (poly_blep(t, dt) - poly_blep(wrap_cycle(t + 0.5), dt));
+    }
+    inline float lastOut() const noexcept { return last_tick_value; }
+
+    //==========================================================================
+    // THE BLIT SQUARE SHIFTS BY HALF A CYCLE PER OFFSET
+    inline void set_phase_offset(float offset_) noexcept { phase_offset = offset_ * 0.5f; }
+    inline void updateHarmonics(double p) noexcept { dt = jmin(0.5, 1.0 / p); }
+
+    //==========================================================================
+    inline void reset() noexcept { last_tick_value = 0; }
+
+  public:
+    //==========================================================================
+    COLD mono_PolyBLEPSquare() noexcept : last_tick_value(0), phase_offset(0), dt(0.5) {}
+    COLD ~mono_PolyBLEPSquare() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_PolyBLEPSquare)
+};
+
+//==============================================================================
+// BUILD SWITCH FOR THE SAW AND SQUARE GENERATORS OF THE OSCILLATORS
+// MONIQUE_POLYBLEP_OSCILLATORS=1 (cmake -DMONIQUE_POLYBLEP_OSCILLATORS=ON) USES POLYBLEP
+#ifndef MONIQUE_POLYBLEP_OSCILLATORS
+#define MONIQUE_POLYBLEP_OSCILLATORS 0
+#endif
+#if MONIQUE_POLYBLEP_OSCILLATORS
+typedef mono_PolyBLEPSaw mono_SawGenerator;
+typedef mono_PolyBLEPSquare mono_SquareGenerator;
+#else
+typedef mono_BlitSaw mono_SawGenerator;
+typedef mono_BlitSquare mono_SquareGenerator;
+#endif
+
+// WAVE: 0 SINE, 1 SQUARE, 2 SAW, 3 NOISE, MIXED LINEAR BETWEEN THE NEIGHBOURS
+static inline bool is_sine_audible(float wave_form_) noexcept { return wave_form_ < 1; }
+static inline bool is_square_audible(float wave_form_) noexcept
+{
+    return wave_form_ > 0 and wave_form_ < 2;
+}
+static inline bool is_saw_audible(float wave_form_) noexcept
+{
+    return wave_form_ > 1 and wave_form_ < 3;
+}
+
 //==============================================================================
 //==============================================================================
 //==============================================================================
@@ -763,6 +1003,25 @@ class mono_SineWaveAutonom : public RuntimeListener
         return lookup(sine_lookup, angle + offset_ * (double_Pi + double_Pi));
     }
     inline float lastOut() const noexcept { return last_tick_value; }
+    // tick() FOR A WHOLE BLOCK, angles_ GETS THE ANGLES (dest_ MAY BE angles_)
+    inline void process(float *angles_, float *dest_, int num_samples_) noexcept
+    {
+        for (int sid = 0; sid != num_samples_; ++sid)
+        {
+            new_cycle = false;
+
+            angle += delta;
+            if (angle > (double_Pi + double_Pi))
+            {
+                angle -= (double_Pi + double_Pi);
+                new_cycle = true;
+            }
+            angles_[sid] = angle;
+        }
+
+        lookup(sine_lookup, angles_, dest_, num_samples_);
+        last_tick_value = dest_[num_samples_ - 1];
+    }
 
     //==========================================================================
     inline void set_frequency(double frequency_) noexcept
@@ -1090,6 +1349,46 @@ class LFO : public RuntimeListener
     DataBuffer *const data_buffer;
     const LFOData *const lfo_data;
     const RuntimeInfo *const runtime_info;
+    const MoniqueSynthData *const synth_data;
+
+    //==============================================================================
+    // SINE TO THE WAVE OF THE LFO, 0...1
+    static inline float shape_amp(float sine_amp_, float wave_, float speed_multi_) noexcept
+    {
+        float amp = sine_amp_ * (1.0f - wave_) +
+                    (fast_atan(sine_amp_ * 250 * jmax(speed_multi_, 1.0f)) * (1.0f / 1.55)) * wave_;
+        if (amp > 1)
+        {
+            amp = 1;
+        }
+        else if (amp < -1)
+        {
+            amp = -1;
+        }
+        return lfo2amp(amp);
+    }
+
+    // THE PERFECT SYNCED LFO AT ANY SAMPLE OF THE BLOCK, FOR THE CONTROL RATE
+    struct PerfectSyncSource
+    {
+        const float *const sine_lookup;
+        const float *const smoothed_wave_buffer;
+        const float *const smoothed_offset_buffer;
+        const int64 block_start;
+        const float cycles_per_sample;
+        const float speed_multi;
+        const int num_samples;
+
+        inline float value_at(int sid_) const noexcept
+        {
+            const int id = jlimit(0, num_samples - 1, sid_);
+            float angle = cycles_per_sample * (block_start + sid_);
+            angle = angle - floor(angle);
+            return shape_amp(lookup(sine_lookup,
+                                    angle * double_Pi_2 + smoothed_offset_buffer[id] * double_Pi_2),
+                             smoothed_wave_buffer[id], speed_multi);
+        }
+    };
 
     //==============================================================================
     inline void calculate_delta(const int samples_per_clock_, const float speed_multi_,
@@ -1211,7 +1510,7 @@ class LFO : public RuntimeListener
                                                      smoothed_offset_buffer[sid] * double_Pi_2);
                                 const float wave = smoothed_wave_buffer[sid];
                                 amp = sine_amp * (1.0f - wave) +
-                                      (std::atan(sine_amp * 250 * jmax(speed_multi, 1.0f)) *
+                                      (fast_atan(sine_amp * 250 * jmax(speed_multi, 1.0f)) *
                                        (1.0f / 1.55)) *
                                           wave;
                                 if (amp > 1)
@@ -1252,45 +1551,51 @@ class LFO : public RuntimeListener
                     lfo_data->wave_smoother.get_smoothed_value_buffer());
                 const float *smoothed_offset_buffer(
                     lfo_data->phase_shift_smoother.get_smoothed_value_buffer());
-                for (int sid = 0; sid != num_samples_; ++sid)
+                const int control_rate = synth_data->control_rate.load(std::memory_order_relaxed);
+                if (control_rate > 1)
+                {
+                    const PerfectSyncSource source{sine_lookup,
+                                                   smoothed_wave_buffer,
+                                                   smoothed_offset_buffer,
+                                                   sync_sample_pos,
+                                                   cycles_per_sample,
+                                                   speed_multi,
+                                                   num_samples_};
+                    render_at_control_rate(
+                        dest_, num_samples_, control_rate,
+                        synth_data->control_rate_is_cubic.load(std::memory_order_relaxed),
+                        source.value_at(-1), source);
+
+                    angle = cycles_per_sample * (sync_sample_pos + num_samples_ - 1);
+                    angle = angle - floor(angle);
+                }
+                else
                 {
-                    float amp;
+                    // ANGLES, THEN THE SINE FOR THE WHOLE BLOCK
+                    for (int sid = 0; sid != num_samples_; ++sid)
                     {
                         angle = cycles_per_sample * sync_sample_pos;
                         angle = angle - floor(angle);
+                        dest_[sid] =
+                            angle * double_Pi_2 + smoothed_offset_buffer[sid] * double_Pi_2;
 
-                        // AMP
-                        {
-                            const float sine_amp =
-                                lookup(sine_lookup, angle * double_Pi_2 +
-                                                        smoothed_offset_buffer[sid] * double_Pi_2);
-                            const float wave = smoothed_wave_buffer[sid];
-                            amp = sine_amp * (1.0f - wave) +
-                                  (std::atan(sine_amp * 250 * jmax(speed_multi, 1.0f)) *
-                                   (1.0f / 1.55)) *
-                                      wave;
-                            if (amp > 1)
-                            {
-                                amp = 1;
-                            }
-                            else if (amp < -1)
-                            {
-                                amp = -1;
-                            }
-                            amp = lfo2amp(amp);
-                        }
+                        ++sync_sample_pos;
                     }
+                    lookup(sine_lookup, dest_, dest_, num_samples_);
 
-                    if (glide_counter > 0 and false)
+                    for (int sid = 0; sid != num_samples_; ++sid)
                     {
-                        --glide_counter;
-                        float glide = (1.0f / glide_samples * glide_counter);
-                        amp = amp * (1.0f - glide) + glide_value * glide;
-                    }
+                        float amp = shape_amp(dest_[sid], smoothed_wave_buffer[sid], speed_multi);
 
-                    dest_[sid] = amp;
+                        if (glide_counter > 0 and false)
+                        {
+                            --glide_counter;
+                            float glide = (1.0f / glide_samples * glide_counter);
+                            amp = amp * (1.0f - glide) + glide_value * glide;
+                        }
 
-                    ++sync_sample_pos;
+                        dest_[sid] = amp;
+                    }
                 }
                 last_out = dest_[num_samples_ - 1];
             }
@@ -1321,7 +1626,7 @@ class LFO : public RuntimeListener
           glide_samples(0), glide_counter(0), glide_value(0),
 
           data_buffer(synth_data_->data_buffer), lfo_data(lfo_data_),
-          runtime_info(synth_data_->runtime_info)
+          runtime_info(synth_data_->runtime_info), synth_data(synth_data_)
     {
     }
     ~LFO() noexcept {}
@@ -1366,8 +1671,8 @@ class MasterOSC : public RuntimeListener
     // RAW OSCILATORS
     //==============================================================================
     PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
+    mono_SawGenerator saw_generator;
+    mono_SquareGenerator square_generator;
     mono_SineWave sine_generator;
     mono_Noise noise;
 
@@ -1467,14 +1772,25 @@ class MasterOSC : public RuntimeListener
             bool is_last_sample_of_cycle = false;
             float sample;
             {
-                // TICK ALL OSCILATTORS
+                const float wave_form = smoothed_wave_buffer[sid];
+
+                // TICK ALL OSCILATTORS, THE ONES WITHOUT STATE ONLY IF THEY ARE AUDIBLE
                 {
                     cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
+                    if (not mono_SawGenerator::is_stateless or is_saw_audible(wave_form))
+                    {
+                        saw_generator.tick(cycle_counter.get_last_phase());
+                    }
                     {
                         double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
+                        if (not mono_SquareGenerator::is_stateless or is_square_audible(wave_form))
+                        {
+                            square_generator.tick(angle);
+                        }
+                        if (is_sine_audible(wave_form))
+                        {
+                            sine_generator.tick(angle);
+                        }
                     }
 
                     // FORCE SYNC OF THE SINE AT THE NEXT SID
@@ -1488,8 +1804,6 @@ class MasterOSC : public RuntimeListener
 
                 // CALC THE SAMPLE MIX
                 {
-                    const float wave_form = smoothed_wave_buffer[sid];
-
                     // SINE - SQUARE
                     if (wave_form <= 1)
                     {
@@ -1685,8 +1999,8 @@ class SecondOSC : public RuntimeListener
     // RAW OSCILATORS
     //==============================================================================
     PerfectCycleCounter cycle_counter;
-    mono_BlitSaw saw_generator;
-    mono_BlitSquare square_generator;
+    mono_SawGenerator saw_generator;
+    mono_SquareGenerator square_generator;
     mono_SineWave sine_generator;
     mono_Noise noise;
 
@@ -1778,15 +2092,26 @@ class SecondOSC : public RuntimeListener
             const bool is_last_sample_of_master_cycle = switch_buffer[sid];
             float sample = 0;
             {
-                // TICK ALL OSCILATTORS
+                const float wave_form = smoothed_wave_buffer[sid];
+
+                // TICK ALL OSCILATTORS, THE ONES WITHOUT STATE ONLY IF THEY ARE AUDIBLE
                 if (not wait_for_new_master_cycle)
                 {
                     cycle_counter.tick();
-                    saw_generator.tick(cycle_counter.get_last_phase());
+                    if (not mono_SawGenerator::is_stateless or is_saw_audible(wave_form))
+                    {
+                        saw_generator.tick(cycle_counter.get_last_phase());
+                    }
                     {
                         double angle = cycle_counter.get_last_angle();
-                        square_generator.tick(angle);
-                        sine_generator.tick(angle);
+                        if (not mono_SquareGenerator::is_stateless or is_square_audible(wave_form))
+                        {
+                            square_generator.tick(angle);
+                        }
+                        if (is_sine_audible(wave_form))
+                        {
+                            sine_generator.tick(angle);
+                        }
                     }
                 }
 
@@ -1826,8 +2151,6 @@ class SecondOSC : public RuntimeListener
                 // CALC THE SAMPLE MIX
                 if (not wait_for_new_master_cycle)
                 {
-                    const float wave_form = smoothed_wave_buffer[sid];
-
                     // SINE - SQUARE
                     if (wave_form <= 1)
                     {
@@ -2082,10 +2405,18 @@ class mono_ENVOsccilator : public RuntimeListener
 
         return out_amp;
     }
+    // SKIPS num_samples_ - 1 SAMPLES, ONLY INSIDE A STAGE: get_samples_left() > num_samples_
+    inline float tick(int num_samples_) noexcept
+    {
+        sample_counter -= num_samples_ - 1;
+        angle += delta * (num_samples_ - 1);
+        return tick();
+    }
 
   public:
     //==========================================================================
     inline float last_out() const noexcept { return out_amp; }
+    inline int get_samples_left() const noexcept { return sample_counter; }
     inline void overwrite_current_value(float amp_) noexcept { out_amp = amp_; }
 
     //==========================================================================
@@ -2166,10 +2497,28 @@ class ENV : RuntimeListener
     //==========================================================================
     inline void process(float *dest_, const int num_samples_) noexcept
     {
+        const int control_rate = synth_data->control_rate.load(std::memory_order_relaxed);
         const float *smoothed_sustain_buffer =
             env_data->sustain_smoother.get_smoothed_value_buffer();
         for (int sid = 0; sid < num_samples_; ++sid)
         {
+            // CONTROL RATE ONLY INSIDE A STAGE, THE STAGE CHANGES STAY SAMPLE ACCURATE. A SUSTAIN
+            // CHANGE INSIDE THE STEP IS PICKED UP AT THE NEXT SAMPLE OF THE SLOW PATH.
+            if (control_rate > 1 and sid + control_rate <= num_samples_ and
+                env_osc.get_samples_left() > control_rate and
+                smoothed_sustain_buffer[sid] == last_sustain and
+                smoothed_sustain_buffer[sid + control_rate - 1] == last_sustain)
+            {
+                const float start = env_osc.last_out();
+                const float delta = (env_osc.tick(control_rate) - start) * (1.0f / control_rate);
+                for (int step = 1; step < control_rate; ++step)
+                {
+                    dest_[sid++] = start + delta * step;
+                }
+                dest_[sid] = env_osc.last_out();
+                continue;
+            }
+
             const float sustain = smoothed_sustain_buffer[sid];
             if (last_sustain != sustain)
             {
@@ -2560,9 +2909,14 @@ class AnalogFilter : public RuntimeListener
         y3 = other_.y3;
         y4 = other_.y4;
     }
+// MoniqueAudioProcessor::process FLUSHES DENORMALS TO ZERO, MONIQUE_NO_UNDENORMALISE RELIES ON IT
+#if MONIQUE_NO_UNDENORMALISE
+#define MONO_UNDENORMALISE(n)
+#else
 #define MONO_UNDENORMALISE(n)                                                                      \
     if (!(n < -1.0e-8f || n > 1.0e-8f))                                                            \
         n = 0;
+#endif
     //==========================================================================
     inline float processLow(float input_and_worker_) noexcept
     {
@@ -2940,53 +3294,465 @@ class DoubleAnalogFilter
 //==============================================================================
 //==============================================================================
 //==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-//==============================================================================
-class FilterProcessor
+// MONO_UNDENORMALISE PER LANE
+static inline mono_float4 mono_undenormalise(mono_float4 n_) noexcept
 {
-    OwnedArray<DoubleAnalogFilter> double_filter;
-    friend class mono_ParameterOwnerStore;
+#if MONIQUE_NO_UNDENORMALISE
+    return n_;
+#else
+    return simd_select_greater(simd_abs(n_), mono_float4::broadcast(1.0e-8f), n_,
+                               mono_float4::broadcast(0));
+#endif
+}
 
-  public:
-    ScopedPointer<ENV> env;
-    Array<ENVData *> input_env_datas;
-    OwnedArray<ENV> input_envs;
+// THE AnalogFilter LADDER FOR MONO_SIMD_LANES CHANNELS, ONE CHANNEL PER LANE (STRUCT OF ARRAYS).
+// ALL LANES SHARE THE COEFFICIENTS, LIKE THE INPUT FILTERS OF ONE FilterProcessor DO.
+class AnalogFilterBank : public RuntimeListener
+{
+    friend class DoubleAnalogFilterBank;
+    mono_float4 p, k, r, res;
+    // r = res * numerator / denominator, ONLY FOR FIXED CUTOFFS
+    mono_float4 resonance_numerator, resonance_denominator;
+    mono_float4 y1, y2, y3, y4;
+    mono_float4 oldx;
+    mono_float4 oldy1, oldy2, oldy3;
 
-  private:
-    const int id;
+    // SAMPLES WITHOUT INPUT AND OUTPUT PER LANE, LANES ABOVE 50 ARE NOT PROCESSED
+    mono_float4 zero_counter;
 
-    const MoniqueSynthData *const synth_data;
-    FilterData *const filter_data;
-    DataBuffer *const data_buffer;
+    float cutoff, res_original;
 
-    const float *const sin_lookup;
-    const float *const cos_lookup;
+    bool force_update;
 
   public:
     //==========================================================================
-    inline void start_attack() noexcept
+    // RETURNS TRUE ON COFF CHANGED
+    inline bool update(float resonance_, float cutoff_) noexcept
     {
-        start_env();
-        start_input_env(0);
-        start_input_env(1);
-        start_input_env(2);
+        bool success = false;
+        if (force_update or (cutoff != cutoff_ || res_original != resonance_))
+        {
+            cutoff = cutoff_;
+            res_original = resonance_;
+            res = mono_float4::broadcast(jmax(0.00001f, resonance_ *= 0.99999));
+            success = true;
+
+            force_update = false;
+        }
+        return success;
     }
-    inline void start_env() noexcept { env->start_attack(); }
-    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
-    inline void start_release() noexcept
+    // AnalogFilter::update_with_fixed_cutoff WITH ONE CUTOFF PER LANE, SET BY set_fixed_cutoffs.
+    // RETURNS TRUE ON COFF CHANGED
+    inline bool update_with_fixed_cutoffs(float resonance_) noexcept
     {
-        start_env_release();
-        start_input_env_release(0);
-        start_input_env_release(1);
-        start_input_env_release(2);
-    }
-    inline void start_env_release() noexcept { env->set_to_release(); }
+        bool success = false;
+        if (force_update or res_original != resonance_)
+        {
+            res_original = resonance_;
+            res = mono_float4::broadcast(resonance_);
+            r = res * resonance_numerator / resonance_denominator;
+            success = true;
+
+            force_update = false;
+        }
+        return success;
+    }
+    COLD void set_fixed_cutoffs(mono_float4 cutoffs_, double sample_rate_) noexcept
+    {
+        const mono_float4 f = cutoffs_ / mono_float4::broadcast(float(sample_rate_));
+        p = f * (mono_float4::broadcast(1.8f) - f * 0.8f);
+        k = p * 2 - 1;
+
+        const mono_float4 t = (mono_float4::broadcast(1) - p) * 1.386249f;
+        const mono_float4 t2 = t * t + 12.0f;
+        resonance_numerator = t2 + t * 6.0f;
+        resonance_denominator = t2 - t * 6.0f;
+
+        force_update = true;
+    }
+
+    //==========================================================================
+    inline void copy_coefficient_from(const AnalogFilterBank &other_) noexcept
+    {
+        cutoff = other_.cutoff;
+        res = other_.res;
+
+        p = other_.p;
+        k = other_.k;
+        r = other_.r;
+    }
+    inline void copy_state_from(const AnalogFilterBank &other_) noexcept
+    {
+        oldx = other_.oldx;
+        oldy1 = other_.oldy1;
+        oldy2 = other_.oldy2;
+        oldy3 = other_.oldy3;
+        y1 = other_.y1;
+        y2 = other_.y2;
+        y3 = other_.y3;
+        y4 = other_.y4;
+    }
+
+  private:
+    //==========================================================================
+    // RETURNS THE MASK OF THE LANES TO PROCESS
+    inline mono_float4 count_zeros(mono_float4 input_) noexcept
+    {
+        zero_counter = simd_select(simd_or(simd_not_zero(input_), simd_not_zero(y4)),
+                                   mono_float4::broadcast(0), zero_counter + 1.0f);
+
+        return simd_greater(mono_float4::broadcast(50), zero_counter);
+    }
+    // FOUR CASCADED ONEPOLE FILTERS (BILINEAR TRANSFORM) AND THE BAND LIMITED SIGMOID CLIPPER,
+    // STATE IS ONLY UPDATED FOR THE ACTIVE LANES
+    inline void process_ladder(mono_float4 input_, mono_float4 active_) noexcept
+    {
+        const mono_float4 new_y1 = input_ * p + oldx * p - k * y1;
+        const mono_float4 new_y2 = new_y1 * p + oldy1 * p - k * y2;
+        const mono_float4 new_y3 = new_y2 * p + oldy2 * p - k * y3;
+        mono_float4 new_y4 = new_y3 * p + oldy3 * p - k * y4;
+        new_y4 = mono_undenormalise(new_y4 -
+                                    (new_y4 * new_y4 * new_y4) / mono_float4::broadcast(6));
+
+        y1 = simd_select(active_, new_y1, y1);
+        y2 = simd_select(active_, new_y2, y2);
+        y3 = simd_select(active_, new_y3, y3);
+        y4 = simd_select(active_, new_y4, y4);
+
+        oldx = simd_select(active_, input_, oldx);
+        oldy1 = y1;
+        oldy2 = y2;
+        oldy3 = y3;
+    }
+
+  public:
+    //==========================================================================
+    inline mono_float4 processLowResonance(mono_float4 input_and_worker_) noexcept
+    {
+        input_and_worker_ = mono_undenormalise(input_and_worker_);
+        const mono_float4 active = count_zeros(input_and_worker_);
+        if (not simd_any(active))
+        {
+            return input_and_worker_;
+        }
+
+        // process input
+        const mono_float4 input = input_and_worker_ - r * y4;
+        y1 = mono_undenormalise(y1);
+
+        process_ladder(input, active);
+
+        return simd_select(
+            active, mono_undenormalise(soft_clipp_greater_1_2(sample_mix(y4, y3 * res))),
+            input_and_worker_);
+    }
+    inline mono_float4 processHighResonance(mono_float4 input_and_worker_) noexcept
+    {
+        input_and_worker_ = mono_undenormalise(input_and_worker_);
+        const mono_float4 active = count_zeros(input_and_worker_);
+        if (not simd_any(active))
+        {
+            return input_and_worker_;
+        }
+
+        // process input
+        const mono_float4 input = mono_undenormalise(input_and_worker_ - r * y4);
+
+        process_ladder(input, active);
+
+        return simd_select(active, mono_undenormalise(hard_clipper_1(input - y4)),
+                           input_and_worker_);
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        y1 = y2 = y3 = y4 = oldx = oldy1 = oldy2 = oldy3 = mono_float4::broadcast(0);
+        zero_counter = mono_float4::broadcast(0);
+    }
+
+    //==========================================================================
+    inline void calc_coefficients(float cutoff_) noexcept
+    {
+        const float f = cutoff_ / sample_rate;
+        const float p_ = f * (1.8f - 0.8f * f);
+        const float t = (1.0f - p_) * 1.386249f;
+        const float t2 = 12.0f + t * t;
+
+        p = mono_float4::broadcast(p_);
+        k = mono_float4::broadcast(p_ * 2 - 1);
+        r = res * (t2 + 6.0f * t) / mono_float4::broadcast(t2 - 6.0f * t);
+    }
+
+  private:
+    //==========================================================================
+    COLD void sample_rate_or_block_changed() noexcept override
+    {
+        reset();
+        force_update = true;
+    }
+
+  public:
+    //==========================================================================
+    COLD AnalogFilterBank(RuntimeNotifyer *const notifyer_) noexcept
+        : RuntimeListener(notifyer_),
+
+          p(mono_float4::broadcast(1)), k(mono_float4::broadcast(1)),
+          r(mono_float4::broadcast(1)), res(mono_float4::broadcast(1)),
+          resonance_numerator(mono_float4::broadcast(1)),
+          resonance_denominator(mono_float4::broadcast(1)),
+
+          cutoff(1000), res_original(0.99999),
+
+          force_update(true)
+    {
+        sample_rate_or_block_changed();
+    }
+    COLD ~AnalogFilterBank() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogFilterBank)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// DoubleAnalogFilter FOR MONO_SIMD_LANES CHANNELS
+class DoubleAnalogFilterBank
+{
+    AnalogFilterBank flt_1;
+    AnalogFilterBank flt_2;
+
+    DoubleAnalogFilterBank *smooth_filter;
+
+    FILTER_TYPS last_filter_type;
+    FILTER_TYPS smooth_filter_type;
+    int glide_time_4_filters;
+
+  public:
+    // LP
+    //==========================================================================
+    inline void updateLow2Pass(float resonance_, float cutoff_) noexcept
+    {
+        if (flt_2.update(resonance_, cutoff_))
+        {
+            flt_2.calc_coefficients(get_cutoff(cutoff_));
+            flt_1.copy_coefficient_from(flt_2);
+        }
+    }
+    inline mono_float4 processLow2Pass(mono_float4 in_) noexcept
+    {
+        const mono_float4 out = flt_2.processLowResonance(in_);
+        const mono_float4 low = flt_1.processLowResonance(out);
+
+        return process_filter_change(in_, sample_mix(out, low));
+    }
+
+    // 1 PASS HP
+    //==========================================================================
+    inline void updateHigh2Pass(float resonance_, float cutoff_) noexcept
+    {
+        if (flt_1.update(resonance_, cutoff_))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_));
+        }
+    }
+    inline mono_float4 processHigh2Pass(mono_float4 in_) noexcept
+    {
+        in_ = soft_clipp_greater_1_2(in_);
+        const mono_float4 out = flt_1.processHighResonance(in_);
+        return process_filter_change(in_, out);
+    }
+
+    // BAND
+    //==========================================================================
+    inline void updateBand(float resonance_, float cutoff_) noexcept
+    {
+        float cutoff_2 = cutoff_ + cutoff_ * 0.02;
+        if (flt_1.update(resonance_, cutoff_2))
+        {
+            flt_1.calc_coefficients(get_cutoff(cutoff_));
+            flt_2.update(resonance_, cutoff_);
+            flt_2.calc_coefficients(get_cutoff(cutoff_));
+        }
+    }
+    inline mono_float4 processBand(mono_float4 in_) noexcept
+    {
+        return process_filter_change(
+            in_, flt_1.processLowResonance(flt_2.processHighResonance(in_)) * 2);
+    }
+
+    // PASS
+    //==========================================================================
+    inline mono_float4 processPass(mono_float4 in_) noexcept
+    {
+        return process_filter_change(in_, in_);
+    }
+
+    // BY TYPE
+    //==========================================================================
+    inline void update_filter_to(FILTER_TYPS type_) noexcept
+    {
+        if (last_filter_type != type_)
+        {
+            if (smooth_filter)
+            {
+                // SET THE SECOND FILTER TO THE OLD COMPLETE STATE
+                if (last_filter_type != PASS)
+                {
+                    smooth_filter->flt_1.copy_coefficient_from(flt_1);
+                    smooth_filter->flt_1.copy_state_from(flt_1);
+
+                    smooth_filter->flt_2.copy_coefficient_from(flt_2);
+                    smooth_filter->flt_2.copy_state_from(flt_2);
+                }
+                else
+                {
+                    flt_1.reset();
+                    flt_2.reset();
+                }
+                flt_1.force_update = true;
+                flt_2.force_update = true;
+
+                glide_time_4_filters = FILTER_CHANGE_GLIDE_TIME_MS;
+
+                smooth_filter->last_filter_type = last_filter_type;
+                smooth_filter_type = last_filter_type;
+            }
+
+            last_filter_type = type_;
+        }
+    }
+    inline mono_float4 process_filter_change(mono_float4 original_in_,
+                                             mono_float4 result_in_) noexcept
+    {
+        if (glide_time_4_filters > 0)
+        {
+            // if( smooth_filter ) IS TRUE IF glide_time_4_filters != 0
+            {
+                const mono_float4 smooth_out =
+                    smooth_filter->processByType(original_in_, smooth_filter_type);
+
+                float mix = 1.0f / float(FILTER_CHANGE_GLIDE_TIME_MS) * glide_time_4_filters;
+                result_in_ = result_in_ * (1.0f - mix) + smooth_out * mix;
+            }
+            --glide_time_4_filters;
+        }
+
+        return result_in_;
+    }
+    inline mono_float4 processByType(mono_float4 io_, FILTER_TYPS type_) noexcept
+    {
+        switch (type_)
+        {
+        case LPF:
+        case LPF_2_PASS:
+            io_ = processLow2Pass(io_);
+            break;
+        case HPF:
+        case HIGH_2_PASS:
+            io_ = processHigh2Pass(io_);
+            break;
+        case BPF:
+            io_ = processBand(io_);
+            break;
+        default /* PASS & UNKNOWN */:;
+        }
+
+        return io_;
+    }
+
+    //==========================================================================
+    inline void reset() noexcept
+    {
+        last_filter_type = UNKNOWN;
+        smooth_filter_type = UNKNOWN;
+        glide_time_4_filters = 0;
+        if (smooth_filter)
+        {
+            smooth_filter->reset();
+        }
+        flt_1.reset();
+        flt_2.reset();
+    }
+
+  public:
+    //==============================================================================
+    COLD DoubleAnalogFilterBank(RuntimeNotifyer *const notifyer_,
+                                bool create_smooth_filter = true) noexcept
+        : flt_1(notifyer_), flt_2(notifyer_),
+
+          smooth_filter(nullptr),
+
+          last_filter_type(UNKNOWN), smooth_filter_type(UNKNOWN),
+
+          glide_time_4_filters(0)
+    {
+        if (create_smooth_filter)
+        {
+            smooth_filter = new DoubleAnalogFilterBank(notifyer_, false);
+        }
+    }
+    COLD ~DoubleAnalogFilterBank() noexcept
+    {
+        if (smooth_filter)
+        {
+            delete smooth_filter;
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DoubleAnalogFilterBank)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class FilterProcessor
+{
+    DoubleAnalogFilterBank filter_bank;
+    friend class mono_ParameterOwnerStore;
+
+  public:
+    ScopedPointer<ENV> env;
+    Array<ENVData *> input_env_datas;
+    OwnedArray<ENV> input_envs;
+
+  private:
+    const int id;
+
+    const MoniqueSynthData *const synth_data;
+    FilterData *const filter_data;
+    DataBuffer *const data_buffer;
+
+    const float *const sin_lookup;
+    const float *const cos_lookup;
+
+  public:
+    //==========================================================================
+    inline void start_attack() noexcept
+    {
+        start_env();
+        start_input_env(0);
+        start_input_env(1);
+        start_input_env(2);
+    }
+    inline void start_env() noexcept { env->start_attack(); }
+    inline void start_input_env(int id_) noexcept { input_envs.getUnchecked(id_)->start_attack(); }
+    inline void start_release() noexcept
+    {
+        start_env_release();
+        start_input_env_release(0);
+        start_input_env_release(1);
+        start_input_env_release(2);
+    }
+    inline void start_env_release() noexcept { env->set_to_release(); }
     inline void start_input_env_release(int id_) noexcept
     {
         input_envs.getUnchecked(id_)->set_to_release();
@@ -3001,9 +3767,7 @@ class FilterProcessor
             input_envs.getUnchecked(input_id)->reset();
         }
 
-        // double_filter[0]->reset();
-        // double_filter[1]->reset();
-        // double_filter[2]->reset();
+        // filter_bank.reset();
     }
 
   private:
@@ -3147,13 +3911,89 @@ class FilterProcessor
             // (std::atan(input_and_worker_)*(1.0f/float_Pi))*
             // x_ = x_*(1.0f-distortion_power_) + 0.5f*soft_clipping( x_*10 )*(distortion_power_);
 
-            x_ = x_ * (1.0f - distortion_power_) + (std::atan(x_ * 20) / 6.66) * distortion_power_;
+            x_ = x_ * (1.0f - distortion_power_) +
+                 (fast_atan(x_ * 20) / 6.66f) * distortion_power_;
 
             // x_ = x_*(1.0f-distortion_power_) + std::atan( x_*150 )*(1.0f/1.55)*distortion_power_;
         }
 
         return x_;
     }
+    static mono_float4 distortion__(mono_float4 x_, float distortion_power_) noexcept
+    {
+        if (distortion_power_ != 0)
+        {
+            x_ = x_ * (1.0f - distortion_power_) +
+                 (fast_atan(x_ * 20) * (1.0f / 6.66f)) * distortion_power_;
+        }
+
+        return x_;
+    }
+
+    //==========================================================================
+    // THE INPUTS OF THIS FILTER ARE THE LANES OF ONE DoubleAnalogFilterBank (FILTER_3 ONLY HAS
+    // THE MIX OF ALL INPUTS IN LANE 0)
+    template <FILTER_TYPS filter_type> inline void process_inputs(const int num_samples) noexcept
+    {
+        static_assert(SUM_INPUTS_PER_FILTER <= MONO_SIMD_LANES, "one lane per filter input");
+
+        const int num_inputs = id != FILTER_3 ? SUM_INPUTS_PER_FILTER : 1;
+        const float *input_buffers[SUM_INPUTS_PER_FILTER];
+        float *out_buffers[SUM_INPUTS_PER_FILTER];
+        for (int input_id = 0; input_id != num_inputs; ++input_id)
+        {
+            pre_process(input_id, num_samples);
+
+            input_buffers[input_id] = data_buffer->filter_input_samples.getReadPointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+            out_buffers[input_id] = data_buffer->filter_output_samples.getWritePointer(
+                input_id + SUM_INPUTS_PER_FILTER * id);
+        }
+
+        const float *const tmp_resonance_buffer =
+            filter_data->resonance_smoother.get_smoothed_value_buffer();
+        const float *const tmp_cuttof_buffer =
+            filter_data->cutoff_smoother.get_smoothed_value_buffer();
+        const float *const tmp_distortion_buffer =
+            filter_data->distortion_smoother.get_smoothed_value_buffer();
+
+        filter_bank.update_filter_to(filter_type);
+        float lanes[MONO_SIMD_LANES] = {0};
+        for (int sid = 0; sid != num_samples; ++sid)
+        {
+            for (int input_id = 0; input_id != num_inputs; ++input_id)
+            {
+                lanes[input_id] = input_buffers[input_id][sid];
+            }
+
+            const float filter_distortion = tmp_distortion_buffer[sid];
+            mono_float4 io = distortion__(mono_float4::load(lanes), filter_distortion);
+            switch (filter_type)
+            {
+            case LPF_2_PASS:
+                filter_bank.updateLow2Pass(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
+                io = filter_bank.processLow2Pass(io);
+                break;
+            case HIGH_2_PASS:
+                filter_bank.updateHigh2Pass(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
+                io = filter_bank.processHigh2Pass(io);
+                break;
+            case BPF:
+                filter_bank.updateBand(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
+                io = filter_bank.processBand(io);
+                break;
+            default: //  PASS
+                io = filter_bank.processPass(io);
+            }
+            float results[MONO_SIMD_LANES];
+            distortion__(io, filter_distortion).store(results);
+
+            for (int input_id = 0; input_id != num_inputs; ++input_id)
+            {
+                out_buffers[input_id][sid] = results[input_id];
+            }
+        }
+    }
 
   public:
     //==========================================================================
@@ -3162,9 +4002,6 @@ class FilterProcessor
         float *amp_mix = data_buffer->lfo_amplitudes.getWritePointer(id);
         // PROCESS FILTER
         {
-#define DISTORTION_IN(x) distortion__(x, filter_distortion)
-#define DISTORTION_OUT(x) distortion__(x, filter_distortion)
-
             // PREPARE
             {
                 process_amp_mix(num_samples);
@@ -3185,274 +4022,17 @@ class FilterProcessor
             case LPF:
             case LPF_2_PASS:
             case MOOG_AND_LPF:
-            {
-                // PROCESSOR
-                struct LP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(LPF_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-
-                            /*
-                                        filter.updateLow2Pass
-                                        (
-                                            tmp_resonance_buffer[sid],
-                                            ( (10180.0f * tmp_cuttof_buffer[sid]) +20 ),
-                                            tmp_gain_buffer[sid]
-                                        );
-                                        */
-
-                            filter.updateLow2Pass(tmp_resonance_buffer[sid],
-                                                  tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processLow2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    LP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                        LP2PassExecuter(this, num_samples, 1).exec();
-                        LP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        LP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
+                process_inputs<LPF_2_PASS>(num_samples);
+                break;
             case HPF:
             case HIGH_2_PASS:
-            {
-                // PROCESSOR
-                struct HP2PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(HIGH_2_PASS);
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateHigh2Pass(tmp_resonance_buffer[sid],
-                                                   tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processHigh2Pass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    HP2PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                    int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                        HP2PassExecuter(this, num_samples, 1).exec();
-                        HP2PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        HP2PassExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
+                process_inputs<HIGH_2_PASS>(num_samples);
+                break;
             case BPF:
-            {
-                // PROCESSOR
-                struct BandExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_resonance_buffer;
-                    const float *const tmp_cuttof_buffer;
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(BPF);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            filter.updateBand(tmp_resonance_buffer[sid], tmp_cuttof_buffer[sid]);
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processBand(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    BandExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_resonance_buffer(processor_->filter_data->resonance_smoother
-                                                   .get_smoothed_value_buffer()),
-                          tmp_cuttof_buffer(
-                              processor_->filter_data->cutoff_smoother.get_smoothed_value_buffer()),
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        BandExecuter(this, num_samples, 0).exec();
-                        BandExecuter(this, num_samples, 1).exec();
-                        BandExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        BandExecuter(this, num_samples, 0).exec();
-                    }
-                }
-            }
-            break;
+                process_inputs<BPF>(num_samples);
+                break;
             default: //  PASS
-            {
-                // PROCESSOR
-                struct PassExecuter
-                {
-                    FilterProcessor *const processor;
-                    DoubleAnalogFilter &filter;
-                    const int input_id;
-                    const int num_samples_;
-
-                    const float *const tmp_distortion_buffer;
-
-                    const float *const input_buffer;
-                    float *const out_buffer;
-
-                    inline void exec() noexcept
-                    {
-                        processor->pre_process(input_id, num_samples_);
-
-                        filter.update_filter_to(PASS);
-
-                        for (int sid = 0; sid != num_samples_; ++sid)
-                        {
-                            const float filter_distortion = tmp_distortion_buffer[sid];
-                            out_buffer[sid] = DISTORTION_OUT(
-                                filter.processPass(DISTORTION_IN(input_buffer[sid])));
-                        }
-                    }
-                    PassExecuter(FilterProcessor *const processor_, int num_samples__,
-                                 int input_id_) noexcept
-                        : processor(processor_),
-                          filter(*processor_->double_filter.getUnchecked(input_id_)),
-                          input_id(input_id_), num_samples_(num_samples__),
-
-                          tmp_distortion_buffer(processor_->filter_data->distortion_smoother
-                                                    .get_smoothed_value_buffer()),
-
-                          input_buffer(processor_->data_buffer->filter_input_samples.getReadPointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id)),
-                          out_buffer(processor_->data_buffer->filter_output_samples.getWritePointer(
-                              input_id_ + SUM_INPUTS_PER_FILTER * processor_->id))
-                    {
-                    }
-                };
-                {
-                    if (id != FILTER_3)
-                    {
-                        PassExecuter(this, num_samples, 0).exec();
-                        PassExecuter(this, num_samples, 1).exec();
-                        PassExecuter(this, num_samples, 2).exec();
-                    }
-                    else
-                    {
-                        // 1, 2 and 3
-                        PassExecuter(this, num_samples, 0).exec();
-                        ;
-                    }
-                }
-            }
-            break;
+                process_inputs<PASS>(num_samples);
             }
         }
 
@@ -3687,7 +4267,9 @@ class FilterProcessor
     COLD FilterProcessor(RuntimeNotifyer *const notifyer_, const MoniqueSynthData *synth_data_,
                          int id_, const float *const sine_lookup_, const float *const cos_lookup_,
                          const float *const exp_lookup_) noexcept
-        : env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
+        : filter_bank(notifyer_),
+
+          env(new ENV(notifyer_, synth_data_, synth_data_->filter_datas[id_]->env_data,
                       sine_lookup_, cos_lookup_, exp_lookup_)),
           input_envs(),
 
@@ -3700,8 +4282,6 @@ class FilterProcessor
     {
         for (int i = 0; i != SUM_INPUTS_PER_FILTER; ++i)
         {
-            double_filter.add(new DoubleAnalogFilter(notifyer_));
-
             ENVData *input_env_data(synth_data_->filter_datas[id_]->input_envs[i]);
             input_env_datas.add(input_env_data);
             input_envs.add(new ENV(notifyer_, synth_data_, input_env_data, sine_lookup_,
@@ -3767,15 +4347,62 @@ static inline int get_high_pass_band_frequency(int band_id_) noexcept
         return 2637.02;
     }
 }
+//==============================================================================
+// IIRFilter::processSingleSampleRaw WITH ONE FILTER PER LANE
+class IIRFilterBank
+{
+    mono_float4 c0, c1, c2, c3, c4;
+    mono_float4 v1, v2;
+
+  public:
+    //==============================================================================
+    inline mono_float4 processSingleSampleRaw(mono_float4 in_) noexcept
+    {
+        const mono_float4 out = mono_undenormalise(c0 * in_ + v1);
+        v1 = c1 * in_ - c3 * out + v2;
+        v2 = c2 * in_ - c4 * out;
+
+        return out;
+    }
+
+    //==============================================================================
+    inline void reset() noexcept { v1 = v2 = mono_float4::broadcast(0); }
+    COLD void set_coefficients(int lane_, const IIRCoefficients &coefficients_) noexcept
+    {
+        mono_float4 *const targets[] = {&c0, &c1, &c2, &c3, &c4};
+        for (int i = 0; i != 5; ++i)
+        {
+            float lanes[MONO_SIMD_LANES];
+            targets[i]->store(lanes);
+            lanes[lane_] = coefficients_.coefficients[i];
+            *targets[i] = mono_float4::load(lanes);
+        }
+    }
+
+    //==============================================================================
+    // LANES WITHOUT COEFFICIENTS OUTPUT ZERO
+    COLD IIRFilterBank() noexcept
+        : c0(mono_float4::broadcast(0)), c1(c0), c2(c0), c3(c0), c4(c0), v1(c0), v2(c0)
+    {
+    }
+    COLD ~IIRFilterBank() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IIRFilterBank)
+};
+
+//==============================================================================
+// ONE EQ BAND PER LANE, THE LAST LANE OF THE LAST GROUP IS UNUSED
+#define SUM_EQ_LANE_GROUPS ((SUM_EQ_BANDS + MONO_SIMD_LANES - 1) / MONO_SIMD_LANES)
+#define SUM_EQ_LANES (SUM_EQ_LANE_GROUPS * MONO_SIMD_LANES)
 class EQProcessor : public RuntimeListener
 {
     friend class EQProcessorStereo;
 
-    float frequency_low_pass[SUM_EQ_BANDS];
+    float frequency_low_pass[SUM_EQ_LANES];
     float frequency_high_pass[SUM_EQ_BANDS];
 
-    OwnedArray<AnalogFilter> filters;
-    IIRFilter high_pass_filters[SUM_EQ_BANDS];
+    OwnedArray<AnalogFilterBank> filters;
+    IIRFilterBank high_pass_filters[SUM_EQ_LANE_GROUPS];
 
     friend class mono_ParameterOwnerStore;
 
@@ -3787,117 +4414,78 @@ class EQProcessor : public RuntimeListener
     //==============================================================================
     inline void reset() noexcept
     {
-        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
         {
-            filters[band_id]->reset();
-            high_pass_filters[band_id].reset();
+            filters[group]->reset();
+            high_pass_filters[group].reset();
         }
     }
 
     void sample_rate_or_block_changed() noexcept override
     {
         reset();
+        for (int lane = 0; lane != SUM_EQ_LANES; ++lane)
+        {
+            // UNUSED LANES GET A VALID CUTOFF TOO
+            frequency_low_pass[lane] = get_low_pass_band_frequency(lane, sample_rate);
+        }
         for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
-            high_pass_filters[band_id].setCoefficients(
+            high_pass_filters[band_id / MONO_SIMD_LANES].set_coefficients(
+                band_id % MONO_SIMD_LANES,
                 IIRCoefficients::makeHighPass(sample_rate, frequency_high_pass[band_id]));
         }
+        for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
+        {
+            filters[group]->set_fixed_cutoffs(
+                mono_float4::load(frequency_low_pass + group * MONO_SIMD_LANES), sample_rate);
+        }
     }
 
     //==============================================================================
     inline void process(float *io_buffer_, int num_samples_) noexcept
     {
+        // ALL BANDS AT ONCE, THE RESONANCE COEFFICIENTS ONLY CHANGE WITH THE SHAPE
         {
-            struct BandExecuter
+            const float *const smoothed_shape_buffer =
+                synth_data->shape_smoother.get_smoothed_value_buffer();
+            const float *env_buffers[SUM_EQ_BANDS];
+            float *band_out_buffers[SUM_EQ_BANDS];
+            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
             {
-                const int band_id;
-
-                const int num_samples_;
-                const float *const smoothed_shape_buffer;
-
-                const float filter_frequency;
-                IIRFilter &high_pass_filter;
-                AnalogFilter &filter;
-
-                const float *const filter_in_samples;
-                float *const band_out_buffer;
-                const float *const env_buffer;
+                env_buffers[band_id] = data_buffer->band_env_buffers.getReadPointer(band_id);
+                band_out_buffers[band_id] = data_buffer->band_out_buffers.getWritePointer(band_id);
+            }
 
-                inline void exec() noexcept { exec_default(); }
-                /*
-inline void exec_first() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = filter.processLowResonance(in);
-        band_out_buffer[sid] = output*4;
-    }
-}
-                */
-                inline void exec_default() noexcept
+            float lanes[SUM_EQ_LANES] = {0};
+            float results[SUM_EQ_LANES];
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                const float shape = smoothed_shape_buffer[sid];
+                const float in = io_buffer_[sid];
+                for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
                 {
-                    // PROCESS
-                    for (int sid = 0; sid != num_samples_; ++sid)
-                    {
-                        const float shape = smoothed_shape_buffer[sid];
-                        const float amp = env_buffer[sid];
-                        const float in = filter_in_samples[sid] * amp;
-                        filter.update_with_fixed_cutoff(shape * 0.8f, filter_frequency);
-                        float output =
-                            high_pass_filter.processSingleSampleRaw(filter.processLowResonance(in));
-                        band_out_buffer[sid] = output * 4;
-                    }
+                    lanes[band_id] = in * env_buffers[band_id][sid];
                 }
-                /*
-inline void exec_last() noexcept
-{
-    // PROCESS
-    for( int sid = 0 ; sid != num_samples_ ; ++sid )
-    {
-        const float shape = smoothed_shape_buffer[sid];
-        const float amp = env_buffer[sid];
-        const float in = filter_in_samples[sid] * amp;
-        filter.update_with_fixed_cutoff( shape*0.8f, filter_frequency );
-        float output = high_pass_filter.processSingleSampleRaw ( filter.processHighResonance(in) );
-        band_out_buffer[sid] = output*1.5;
-    }
-}
-                */
-                BandExecuter(EQProcessor *const processor_, float *in_buffer_, int num_samples__,
-                             int band_id_) noexcept
-                    : band_id(band_id_),
-
-                      num_samples_(num_samples__),
-                      smoothed_shape_buffer(
-                          processor_->synth_data->shape_smoother.get_smoothed_value_buffer()),
-
-                      filter_frequency(processor_->frequency_low_pass[band_id_]),
-                      high_pass_filter(processor_->high_pass_filters[band_id_]),
-                      filter(*processor_->filters.getUnchecked(band_id_)),
-
-                      filter_in_samples(in_buffer_),
-                      band_out_buffer(
-                          processor_->data_buffer->band_out_buffers.getWritePointer(band_id_)),
-                      env_buffer(
-                          processor_->data_buffer->band_env_buffers.getWritePointer(band_id_))
+
+                for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
                 {
+                    AnalogFilterBank &filter = *filters.getUnchecked(group);
+                    filter.update_with_fixed_cutoffs(shape * 0.8f);
+                    const mono_float4 output = high_pass_filters[group].processSingleSampleRaw(
+                        filter.processLowResonance(
+                            mono_float4::load(lanes + group * MONO_SIMD_LANES)));
+                    (output * 4).store(results + group * MONO_SIMD_LANES);
                 }
-            };
 
-            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
-            {
-                BandExecuter(this, io_buffer_, num_samples_, band_id).exec();
+                for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+                {
+                    band_out_buffers[band_id][sid] = results[band_id];
+                }
             }
         }
-        // EO MULTITHREADED
 
-        // FINAL MIX - SINGLE THREADED ( NO REALY OPTIMIZED )
+        // FINAL MIX - FOUR SAMPLES AT ONCE
         {
             const float *const buffer_1(data_buffer->band_out_buffers.getReadPointer(0));
             const float *const buffer_2(data_buffer->band_out_buffers.getReadPointer(1));
@@ -3915,7 +4503,29 @@ inline void exec_last() noexcept
                 synth_data->effect_bypass_smoother.get_smoothed_value_buffer();
             const float *const smoothed_bypass =
                 eq_data->bypass_smoother.get_smoothed_value_buffer();
-            for (int sid = 0; sid != num_samples_; ++sid)
+            int sid = 0;
+            for (; sid <= num_samples_ - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+            {
+                const mono_float4 one = mono_float4::broadcast(1);
+                const mono_float4 distortion = mono_float4::load(smoothed_distortion + sid) *
+                                               mono_float4::load(smoothed_fx_bypass_buffer + sid);
+                const mono_float4 bypass = mono_float4::load(smoothed_bypass + sid);
+                mono_float4 sum = sample_mix(mono_float4::load(buffer_7 + sid),
+                                             mono_float4::load(buffer_6 + sid));
+                sum = sample_mix(sum, mono_float4::load(buffer_5 + sid));
+                sum = sample_mix(sum, mono_float4::load(buffer_4 + sid));
+                sum = sample_mix(sum, mono_float4::load(buffer_3 + sid));
+                sum = sample_mix(sum, mono_float4::load(buffer_2 + sid));
+                sum = sample_mix(sum, mono_float4::load(buffer_1 + sid) * -1);
+
+                const mono_float4 in = mono_float4::load(io_buffer_ + sid);
+                const mono_float4 mix = simd_select_greater(bypass, mono_float4::broadcast(0),
+                                                            sum * bypass + in * (one - bypass), in);
+                soft_clipp_greater_1_2(mix * (one - distortion) +
+                                       (fast_atan(mix * 10) * 0.7f) * distortion)
+                    .store(io_buffer_ + sid);
+            }
+            for (; sid < num_samples_; ++sid)
             {
                 const float distortion = smoothed_distortion[sid] * smoothed_fx_bypass_buffer[sid];
                 const float bypass = smoothed_bypass[sid];
@@ -3933,15 +4543,13 @@ inline void exec_last() noexcept
                     // MONO_SNAP_TO_ZERO(sum)
                     float mix = sum * bypass + io_buffer_[sid] * (1.0f - bypass);
                     io_buffer_[sid] = soft_clipp_greater_1_2(
-                        mix * (1.0f - distortion) + (std::atan(mix * 10) * 0.7f) * distortion);
-                    // io_buffer_[sid] = soft_clipp_greater_1_2(sample_mix(mix*(1.0f-distortion),
-                    // sample_mix( mix, mix )*distortion));
+                        mix * (1.0f - distortion) + (fast_atan(mix * 10) * 0.7f) * distortion);
                 }
                 else
                 {
                     io_buffer_[sid] = soft_clipp_greater_1_2(
                         io_buffer_[sid] * (1.0f - distortion) +
-                        (std::atan(io_buffer_[sid] * 10) * 0.7f) * distortion);
+                        (fast_atan(io_buffer_[sid] * 10) * 0.7f) * distortion);
                 }
             }
         }
@@ -3959,11 +4567,12 @@ inline void exec_last() noexcept
         std::cout << "MONIQUE: init EQ L OR R" << std::endl;
 #endif
 
+        for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
+        {
+            filters.add(new AnalogFilterBank(notifyer_));
+        }
         for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
         {
-            filters.add(new AnalogFilter(notifyer_));
-
-            frequency_low_pass[band_id] = get_low_pass_band_frequency(band_id, sample_rate);
             frequency_high_pass[band_id] = get_high_pass_band_frequency(band_id);
         }
         sample_rate_or_block_changed();
@@ -4072,20 +4681,23 @@ class EQProcessorStereo
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// THE DELAY LINE IS A POWER OF TWO BUFFER, A MASK REPLACES THE % WRAP
 class AllPassFilter
 {
     HeapBlock<float> buffer;
-    int bufferSize, bufferIndex;
+    int delay, bufferMask, bufferIndex;
 
   public:
     //==============================================================================
     inline float process(const float input) noexcept
     {
-        const float bufferedValue = buffer[bufferIndex];
+        const float bufferedValue = buffer[(bufferIndex - delay) & bufferMask];
         float temp = input + (bufferedValue * 0.5f);
+#if !MONIQUE_NO_UNDENORMALISE
         JUCE_UNDENORMALISE(temp);
+#endif
         buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
+        bufferIndex = (bufferIndex + 1) & bufferMask;
 
         return bufferedValue - input;
     }
@@ -4093,20 +4705,25 @@ class AllPassFilter
     //==============================================================================
     COLD void setSize(const int size)
     {
-        if (size != bufferSize)
+        if (size != delay)
         {
+            const int bufferSize = nextPowerOfTwo(size);
+            if (bufferSize != bufferMask + 1)
+            {
+                buffer.malloc((size_t)bufferSize);
+                bufferMask = bufferSize - 1;
+            }
             bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
+            delay = size;
         }
 
         clear();
     }
-    COLD void clear() noexcept { buffer.clear((size_t)bufferSize); }
+    COLD void clear() noexcept { buffer.clear((size_t)bufferMask + 1); }
 
   public:
     //==============================================================================
-    COLD AllPassFilter() noexcept : bufferSize(0), bufferIndex(0) {}
+    COLD AllPassFilter() noexcept : delay(0), bufferMask(-1), bufferIndex(0) {}
     COLD ~AllPassFilter() noexcept {}
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AllPassFilter)
@@ -4133,7 +4750,13 @@ class mono_Chorus : public RuntimeListener
     mono_SineWaveAutonom osc_4;
     mono_SineWaveAutonom osc_5;
 
+#define SUM_DELAY_LINES 4
+    // THE AMPS OF THE DELAY LINES, THE ANGLES OF OSC 1 AND ONE WORKER
+    mono_AudioSampleBuffer<SUM_DELAY_LINES + 2> modulation_buffer;
+
+    // POWER OF TWO, WRAPPED WITH buffer_mask
     int buffer_size;
+    int buffer_mask;
     int index;
     mono_AudioSampleBuffer<2> data_buffer;
     float *current_left_buffer;
@@ -4142,8 +4765,66 @@ class mono_Chorus : public RuntimeListener
     const float *const sin_lookup;
     const float *const cos_lookup;
 
+    //==============================================================================
+    // THE AMP CURVES OF ALL DELAY LINES FOR THE WHOLE BLOCK
+    inline void process_modulation(int num_samples_) noexcept
+    {
+        static const float osc_1_offsets[SUM_DELAY_LINES] = {0, 0.25f, 0.5f, 0.75f};
+        static const float osc_1_amps[SUM_DELAY_LINES] = {0.7f, 0.3f, 0.4f, 0.6f};
+        static const float osc_amps[SUM_DELAY_LINES] = {0.3f, 0.6f, 0.5f, 0.4f};
+        mono_SineWaveAutonom *const oscs[SUM_DELAY_LINES] = {&osc_2, &osc_3, &osc_4, &osc_5};
+
+        float *const angles = modulation_buffer.getWritePointer(SUM_DELAY_LINES);
+        float *const osc_1_samples = modulation_buffer.getWritePointer(SUM_DELAY_LINES + 1);
+        osc_1.process(angles, osc_1_samples, num_samples_);
+        for (int i = 0; i != SUM_DELAY_LINES; ++i)
+        {
+            if (i != 0)
+            {
+                FloatVectorOperations::add(osc_1_samples, angles,
+                                           osc_1_offsets[i] * (double_Pi + double_Pi),
+                                           num_samples_);
+                lookup(sin_lookup, osc_1_samples, osc_1_samples, num_samples_);
+            }
+
+            float *const amps = modulation_buffer.getWritePointer(i);
+            oscs[i]->process(amps, amps, num_samples_);
+            for (int sid = 0; sid != num_samples_; ++sid)
+            {
+                amps[sid] = ((osc_1_samples[sid] * osc_1_amps[i] + amps[sid] * osc_amps[i]) + 1) *
+                            0.5f;
+            }
+        }
+    }
+
+    // THE FOUR LINEAR INTERPOLATED TAPS OF ONE CHANNEL AS LANES
+    inline float read_taps(const float *buffer_, mono_float4 delays_) const noexcept
+    {
+        float positions[SUM_DELAY_LINES];
+        (mono_float4::broadcast(float(index + 1)) - delays_).store(positions);
+
+        float samples_1[SUM_DELAY_LINES];
+        float samples_2[SUM_DELAY_LINES];
+        float deltas[SUM_DELAY_LINES];
+        for (int i = 0; i != SUM_DELAY_LINES; ++i)
+        {
+            // FLOOR, THE POSITION CAN BE NEGATIVE
+            const int truncated = int(positions[i]);
+            const int index_1 = truncated - (positions[i] < truncated);
+            deltas[i] = positions[i] - index_1;
+            samples_1[i] = buffer_[index_1 & buffer_mask];
+            samples_2[i] = buffer_[(index_1 + 1) & buffer_mask];
+        }
+
+        static const float tap_amps[SUM_DELAY_LINES] = {1.0f / 2, 1.0f / 3, 1.0f / 4, 1.0f / 5};
+        const mono_float4 delta = mono_float4::load(deltas);
+        const mono_float4 taps =
+            mono_float4::load(samples_1) * (mono_float4::broadcast(1) - delta) +
+            mono_float4::load(samples_2) * delta;
+        return simd_sum(taps * mono_float4::load(tap_amps));
+    }
+
   public:
-#define SUM_DELAY_LINES 4
     inline void process(float *left_in_, float *right_in_, float *left_out_, float *right_out_,
                         int num_samples_) noexcept
     {
@@ -4152,86 +4833,42 @@ class mono_Chorus : public RuntimeListener
         const float *const smoothed_pan_buffer(
             chorus_data->pan_smoother.get_smoothed_value_buffer());
 
+        process_modulation(num_samples_);
+        const float *const amps_buffers[SUM_DELAY_LINES] = {
+            modulation_buffer.getReadPointer(0), modulation_buffer.getReadPointer(1),
+            modulation_buffer.getReadPointer(2), modulation_buffer.getReadPointer(3)};
+
         const float e_samples = sample_rate / 164.81; // 82.41;
         const float e2_samples = sample_rate / 165.91;
+        const bool is_stereo = synth_data->is_stereo;
         for (int sid = 0; sid != num_samples_; ++sid)
         {
             // const float power = (exp( (chorus_env_buffer[sid] *0.85f) *2)-1)/6.38906;
             const float power = chorus_env_buffer[sid] * 0.8f;
-            const float amps[SUM_DELAY_LINES] = {
-                ((osc_1.tick() * 0.7f + osc_2.tick() * 0.3f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.25f) * 0.3f + osc_3.tick() * 0.6f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.5f) * 0.4f + osc_4.tick() * 0.5f) + 1) * 0.5f,
-                ((osc_1.lastOut_with_phase_offset(0.75f) * 0.6f + osc_5.tick() * 0.4f) + 1) * 0.5f};
+            const float amps_array[SUM_DELAY_LINES] = {amps_buffers[0][sid], amps_buffers[1][sid],
+                                                       amps_buffers[2][sid], amps_buffers[3][sid]};
+            const mono_float4 delays = mono_float4::load(amps_array) * float(power * 0.9 + 0.1);
             const float pan = smoothed_pan_buffer[sid];
 
-#define CHECK_MAKE_INDEX_VALID(floated_index_, size_)                                              \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }                                                                                              \
-    else if (floated_index_ < 0)                                                                   \
-    {                                                                                              \
-        floated_index_ += size_;                                                                   \
-    }
-#define CHECK_MAKE_INDEX_VALID_upper_only(floated_index_, size_)                                   \
-    if (floated_index_ >= size_)                                                                   \
-    {                                                                                              \
-        floated_index_ -= size_;                                                                   \
-    }
-            // L
             const float fade_in = 1.0f - (jmin(1.0f, power * 2));
             const float fade_effect = (jmin(1.0f, power * 2));
+            // L
             {
-                float result_l = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
-                {
-                    float delay = (power * 0.9 + 0.1) * e_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_l += (current_left_buffer[index_1] * (1.0f - delta) +
-                                 current_left_buffer[index_2] * delta) /
-                                (i + 2);
-                }
-                {
-                    current_left_buffer[index] =
-                        sample_mix(left_in_[sid], result_l * power * left_pan(pan, sin_lookup));
-                    left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
-                }
+                const float result_l = read_taps(current_left_buffer, delays * e_samples);
+                current_left_buffer[index] =
+                    sample_mix(left_in_[sid], result_l * power * left_pan(pan, sin_lookup));
+                left_out_[sid] = left_in_[sid] * fade_in + result_l * fade_effect;
             }
             // R
-            if (synth_data->is_stereo)
+            if (is_stereo)
             {
-                float result_r = 0;
-                for (int i = 0; i != SUM_DELAY_LINES; ++i)
-                {
-                    float delay = (power * 0.9 + 0.1) * e2_samples * amps[i];
-                    float float_index = float(index) - delay + 1;
-                    CHECK_MAKE_INDEX_VALID(float_index, buffer_size)
-
-                    const int index_1 = std::floor(float_index);
-                    int index_2 = index_1 + 1;
-                    CHECK_MAKE_INDEX_VALID_upper_only(index_2, buffer_size) const float delta =
-                        float_index - index_1;
-
-                    result_r += (current_right_buffer[index_1] * (1.0f - delta) +
-                                 current_right_buffer[index_2] * delta) /
-                                (i + 2);
-                }
-                {
-                    current_right_buffer[index] =
-                        sample_mix(right_in_[sid], result_r * power * right_pan(pan, cos_lookup));
-                    right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
-                }
+                const float result_r = read_taps(current_right_buffer, delays * e2_samples);
+                current_right_buffer[index] =
+                    sample_mix(right_in_[sid], result_r * power * right_pan(pan, cos_lookup));
+                right_out_[sid] = right_in_[sid] * fade_in + result_r * fade_effect;
             }
 
-            index = (index + 1) % buffer_size;
+            index = (index + 1) & buffer_mask;
         }
     }
 
@@ -4239,7 +4876,11 @@ class mono_Chorus : public RuntimeListener
     //==============================================================================
     COLD void sample_rate_or_block_changed() noexcept override
     {
-        buffer_size = sample_rate / 82.41;
+        modulation_buffer.setSize(block_size);
+
+        buffer_size = nextPowerOfTwo(int(sample_rate / 82.41));
+        buffer_mask = buffer_size - 1;
+        index &= buffer_mask;
         data_buffer.setSize(buffer_size, false);
         data_buffer.clear();
 
@@ -4258,7 +4899,9 @@ class mono_Chorus : public RuntimeListener
           osc_3(notifyer_, synth_data_->sine_lookup), osc_4(notifyer_, synth_data_->sine_lookup),
           osc_5(notifyer_, synth_data_->sine_lookup),
 
-          buffer_size(1), index(0), data_buffer(buffer_size),
+          modulation_buffer(1),
+
+          buffer_size(1), buffer_mask(0), index(0), data_buffer(buffer_size),
 
           chorus_data(synth_data_->chorus_data),
 
@@ -4286,12 +4929,17 @@ class mono_Chorus : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// THE BUFFERS ARE ALLOCATED FOR THE SLOWEST TEMPO ON SAMPLE RATE CHANGES, TEMPO AND SIZE CHANGES
+// ONLY SWITCH THE LENGTHS
+#define DELAY_MIN_BPM 20
+#define DELAY_RECORD_CROSSFADE_MS 20
 class mono_Delay : public RuntimeListener
 {
     const MoniqueSynthData *synth_data;
     RuntimeInfo *info;
 
     double last_bmp_in;
+    double allocated_sample_rate;
 
     int reflexion_write_index;
     int last_in_reflexion_size;
@@ -4308,11 +4956,18 @@ class mono_Delay : public RuntimeListener
     int record_buffer_size;
     int real_record_buffer_size;
     int num_records_to_write;
+    int record_buffer_used_size; // TO CLEAR, THE BIGGEST SIZE SINCE THE LAST CLEAR
     mono_AudioSampleBuffer<2> record_buffer;
     float *active_left_record_buffer;
     float *active_right_record_buffer;
     bool force_clear;
 
+    // THE LOOP OF THE OLD LENGTH FADES OUT AFTER A LENGTH CHANGE
+    int record_crossfade_index;
+    int record_crossfade_buffer_size;
+    int record_crossfade_samples_left;
+    int record_crossfade_samples;
+
     LinearSmootherMinMax<0, 1> record_switch_smoother;
 
     const float *const sin_lookup;
@@ -4324,7 +4979,7 @@ class mono_Delay : public RuntimeListener
                                    int glide_time_in_ms_, double bpm_) noexcept
     {
         // SETUP THE REFLEXION BUFFER
-        if (bpm_ < 20)
+        if (bpm_ < DELAY_MIN_BPM)
         {
             return;
         }
@@ -4372,15 +5027,12 @@ class mono_Delay : public RuntimeListener
             reflexion_buffer_size = floor(samples_per_bar);
             reflexion = samples_per_bar * speed_multi;
         }
-        if (reflexion_buffer.get_size() < reflexion_buffer_size)
-        {
-            reflexion_buffer.setSize(reflexion_buffer_size, true);
-            active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
-            active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
-        }
+        jassert(reflexion_buffer.get_size() >= reflexion_buffer_size);
     }
     inline void update_record_stuff(double bpm_) noexcept
     {
+        const int last_real_record_buffer_size = real_record_buffer_size;
+
         // CALCULATE THE NEEDED SIZE
         {
             num_records_to_write = delay_multi(last_in_record_size); // 1, 2 or 4
@@ -4390,13 +5042,45 @@ class mono_Delay : public RuntimeListener
             record_buffer_size = samples_per_bar;
             // TODO change the record index only on zero
         }
-        if (record_buffer.get_size() < real_record_buffer_size)
+        jassert(record_buffer.get_size() >= real_record_buffer_size);
+        record_buffer_used_size = jmax(record_buffer_used_size, real_record_buffer_size);
+
+        if (last_real_record_buffer_size != real_record_buffer_size)
+        {
+            record_crossfade_index = record_index;
+            record_crossfade_buffer_size = last_real_record_buffer_size;
+            record_crossfade_samples_left = record_crossfade_samples;
+
+            record_index %= real_record_buffer_size;
+        }
+    }
+
+    //==============================================================================
+    inline float crossfade_record(const float *record_buffer_, float record_) const noexcept
+    {
+        if (record_crossfade_samples_left > 0)
+        {
+            const float old_amp = float(record_crossfade_samples_left) / record_crossfade_samples;
+            return record_ * (1.0f - old_amp) + record_buffer_[record_crossfade_index] * old_amp;
+        }
+
+        return record_;
+    }
+    inline void update_record_crossfade() noexcept
+    {
+        if (record_crossfade_samples_left > 0)
         {
-            record_buffer.setSize(real_record_buffer_size, true);
-            active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-            active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+            --record_crossfade_samples_left;
+            record_crossfade_index = (record_crossfade_index + 1) % record_crossfade_buffer_size;
         }
     }
+    inline void clear_used_record_buffer() noexcept
+    {
+        FloatVectorOperations::clear(record_buffer.getWritePointer(LEFT), record_buffer_used_size);
+        FloatVectorOperations::clear(record_buffer.getWritePointer(RIGHT), record_buffer_used_size);
+        record_buffer_used_size = real_record_buffer_size;
+        record_crossfade_samples_left = 0;
+    }
 
   private:
     //==============================================================================
@@ -4575,14 +5259,16 @@ class mono_Delay : public RuntimeListener
                     }
                     else if (force_clear)
                     {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
-                        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+                        clear_used_record_buffer();
                         force_clear = false;
                     }
 
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
-                    io_r[sid] = sample_mix(right_record, right_reflexion_and_input_mix);
+                    io_l[sid] =
+                        sample_mix(crossfade_record(active_left_record_buffer, left_record),
+                                   left_reflexion_and_input_mix);
+                    io_r[sid] =
+                        sample_mix(crossfade_record(active_right_record_buffer, right_record),
+                                   right_reflexion_and_input_mix);
                 }
 
                 // UPDATE INDEX
@@ -4590,6 +5276,7 @@ class mono_Delay : public RuntimeListener
                     reflexion_write_index =
                         (reflexion_write_index + 1) % current_reflexion_buffer_size;
                     record_index = (record_index + 1) % real_record_buffer_size;
+                    update_record_crossfade();
                 }
             }
         }
@@ -4681,12 +5368,13 @@ class mono_Delay : public RuntimeListener
                     }
                     else if (force_clear)
                     {
-                        record_buffer.clear();
-                        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+                        clear_used_record_buffer();
                         force_clear = false;
                     }
 
-                    io_l[sid] = sample_mix(left_record, left_reflexion_and_input_mix);
+                    io_l[sid] =
+                        sample_mix(crossfade_record(active_left_record_buffer, left_record),
+                                   left_reflexion_and_input_mix);
                 }
 
                 // UPDATE INDEX
@@ -4694,6 +5382,7 @@ class mono_Delay : public RuntimeListener
                     reflexion_write_index =
                         (reflexion_write_index + 1) % current_reflexion_buffer_size;
                     record_index = (record_index + 1) % real_record_buffer_size;
+                    update_record_crossfade();
                 }
             }
         }
@@ -4716,8 +5405,42 @@ class mono_Delay : public RuntimeListener
     //==============================================================================
     COLD void sample_rate_or_block_changed() noexcept override
     {
+        const bool sample_rate_changed = allocated_sample_rate != sample_rate;
+        if (sample_rate_changed)
+        {
+            allocate_buffers();
+        }
+
         update_record_stuff(last_bmp_in);
         update_reflexion_stuff(last_bmp_in);
+
+        if (sample_rate_changed)
+        {
+            record_crossfade_samples_left = 0;
+        }
+    }
+    COLD void allocate_buffers() noexcept
+    {
+        allocated_sample_rate = sample_rate;
+
+        const double bars_per_sec = double(DELAY_MIN_BPM) / 4 / 60;
+        const double max_samples_per_bar = (1.0f / bars_per_sec) * sample_rate;
+        reflexion_buffer.setSize(floor(max_samples_per_bar));
+        reflexion_buffer.clear();
+        active_left_reflexion_buffer = reflexion_buffer.getWritePointer(LEFT);
+        active_right_reflexion_buffer = reflexion_buffer.getWritePointer(RIGHT);
+        reflexion_write_index = 0;
+        current_reflexion_buffer_size =
+            jmin(current_reflexion_buffer_size, reflexion_buffer.get_size());
+
+        record_buffer.setSize(max_samples_per_bar * 4);
+        record_buffer.clear();
+        active_left_record_buffer = record_buffer.getWritePointer(LEFT);
+        active_right_record_buffer = record_buffer.getWritePointer(RIGHT);
+        record_index = 0;
+        record_buffer_used_size = 0;
+
+        record_crossfade_samples = jmax(1, msToSamplesFast(DELAY_RECORD_CROSSFADE_MS, sample_rate));
     }
 
   public:
@@ -4727,7 +5450,7 @@ class mono_Delay : public RuntimeListener
 
           synth_data(synth_data_),
 
-          last_bmp_in(20),
+          last_bmp_in(DELAY_MIN_BPM), allocated_sample_rate(0),
 
           reflexion_write_index(0), last_in_reflexion_size(0), reflexion(0), current_reflexion(0),
           reflexion_buffer_size(1), current_reflexion_buffer_size(1),
@@ -4737,13 +5460,16 @@ class mono_Delay : public RuntimeListener
 
           record_index(0), last_in_record_size(0), record_buffer_size(1),
           real_record_buffer_size(record_buffer_size), num_records_to_write(1),
-          record_buffer(real_record_buffer_size),
+          record_buffer_used_size(0), record_buffer(real_record_buffer_size),
           active_left_record_buffer(record_buffer.getWritePointer(LEFT)),
           active_right_record_buffer(record_buffer.getWritePointer(RIGHT)), force_clear(false),
 
+          record_crossfade_index(0), record_crossfade_buffer_size(1),
+          record_crossfade_samples_left(0), record_crossfade_samples(1),
+
           record_switch_smoother(),
 
-          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->sine_lookup)
+          sin_lookup(synth_data_->sine_lookup), cos_lookup(synth_data_->cos_lookup)
     {
         sample_rate_or_block_changed();
         record_switch_smoother.set_value(0);
@@ -4763,53 +5489,85 @@ class mono_Delay : public RuntimeListener
 //==============================================================================
 //==============================================================================
 //==============================================================================
-class CombFilter
+// THE PARALLEL COMB FILTERS OF THE REVERB, ONE COMB PER LANE. THE DELAY LINES ARE INTERLEAVED IN
+// ONE POWER OF TWO BUFFER (ONE FRAME OF SUM_REVERB_COMBS SAMPLES PER POSITION), SO THE WRITE IS
+// A VECTOR STORE AND A MASK REPLACES THE % WRAP
+#define SUM_REVERB_COMBS 8
+#define SUM_REVERB_COMB_GROUPS (SUM_REVERB_COMBS / MONO_SIMD_LANES)
+class CombFilterBank
 {
     HeapBlock<float> buffer;
-    float last;
-    int bufferSize, bufferIndex;
+    int delays[SUM_REVERB_COMBS];
+    int bufferMask, bufferIndex;
 
   public:
     //==============================================================================
+    // RETURNS THE SUM OF ALL COMBS
     inline float process(const float input, const float feedbackLevel) noexcept
     {
 #define REVERB_DAMP 0
-        last = buffer[bufferIndex];
-        // last = (output * (1.0f - REVERB_DAMP)) + (last * REVERB_DAMP);
-        // JUCE_UNDENORMALISE (last);
+        float last[SUM_REVERB_COMBS];
+        for (int comb_id = 0; comb_id != SUM_REVERB_COMBS; ++comb_id)
+        {
+            const int position = (bufferIndex - delays[comb_id]) & bufferMask;
+            last[comb_id] = buffer[position * SUM_REVERB_COMBS + comb_id];
+        }
 
-        float temp = input + (last * feedbackLevel);
-        JUCE_UNDENORMALISE(temp);
-        buffer[bufferIndex] = temp;
-        bufferIndex = (bufferIndex + 1) % bufferSize;
+        float *const frame = buffer + bufferIndex * SUM_REVERB_COMBS;
+        mono_float4 sum = mono_float4::broadcast(0);
+        for (int group = 0; group != SUM_REVERB_COMB_GROUPS; ++group)
+        {
+            const mono_float4 group_last = mono_float4::load(last + group * MONO_SIMD_LANES);
+
+#if MONIQUE_NO_UNDENORMALISE
+            const mono_float4 temp = group_last * feedbackLevel + input;
+#else
+            // JUCE_UNDENORMALISE
+            const mono_float4 temp = ((group_last * feedbackLevel + input) + 0.1f) - 0.1f;
+#endif
+            temp.store(frame + group * MONO_SIMD_LANES);
+
+            sum = sum + group_last;
+        }
+        bufferIndex = (bufferIndex + 1) & bufferMask;
 
-        return last;
+        return simd_sum(sum);
     }
 
     //==============================================================================
-    COLD void setSize(const int size)
+    COLD void setSizes(const int *sizes)
     {
-        if (size != bufferSize)
+        int maxSize = 1;
+        for (int comb_id = 0; comb_id != SUM_REVERB_COMBS; ++comb_id)
         {
-            bufferIndex = 0;
-            buffer.malloc((size_t)size);
-            bufferSize = size;
+            delays[comb_id] = sizes[comb_id];
+            maxSize = jmax(maxSize, sizes[comb_id]);
+        }
+
+        const int bufferSize = nextPowerOfTwo(maxSize);
+        if (bufferSize != bufferMask + 1)
+        {
+            buffer.malloc((size_t)bufferSize * SUM_REVERB_COMBS);
+            bufferMask = bufferSize - 1;
         }
+        bufferIndex = 0;
 
         clear();
     }
-    COLD void clear() noexcept
-    {
-        last = 0;
-        buffer.clear((size_t)bufferSize);
-    }
+    COLD void clear() noexcept { buffer.clear((size_t)(bufferMask + 1) * SUM_REVERB_COMBS); }
 
   public:
     //==============================================================================
-    COLD CombFilter() noexcept : last(0), bufferSize(0), bufferIndex(0) {}
-    COLD ~CombFilter() noexcept {}
+    COLD CombFilterBank() noexcept : bufferMask(-1), bufferIndex(0)
+    {
+        for (int comb_id = 0; comb_id != SUM_REVERB_COMBS; ++comb_id)
+        {
+            delays[comb_id] = 0;
+        }
+    }
+    COLD ~CombFilterBank() noexcept {}
 
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilter)
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CombFilterBank)
 };
 
 //==============================================================================
@@ -4910,11 +5668,11 @@ class mono_Reverb : RuntimeListener
 
     enum
     {
-        numCombs = 8,
+        numCombs = SUM_REVERB_COMBS,
         numAllPasses = 4
     };
 
-    CombFilter comb[numCombs];
+    CombFilterBank combs;
     AllPassFilter allPass[numAllPasses];
 
     ReverbParameters parameters;
@@ -4926,14 +5684,7 @@ class mono_Reverb : RuntimeListener
     //==========================================================================
     inline float processSingleSampleRaw(float in) noexcept
     {
-        float out = 0;
-        {
-            const float input = in * REVERB_GAIN;
-            for (int j = 0; j != numCombs; ++j) // accumulate the comb filters in parallel
-            {
-                out += comb[j].process(input, feedback);
-            }
-        }
+        float out = combs.process(in * REVERB_GAIN, feedback); // the comb filters in parallel
         for (int j = 0; j != numAllPasses; ++j) // run the allpass filters in series
         {
             out = allPass[j].process(out);
@@ -4967,19 +5718,21 @@ class mono_Reverb : RuntimeListener
         const int stereoSpread = 23;
         const int intSampleRate = (int)sample_rate;
 
+        int combSizes[numCombs];
         for (int i = 0; i < numCombs; ++i)
         {
             if (left_or_right == LEFT)
             {
-                comb[i].setSize((intSampleRate * combTunings[i] * ROOM_SCALE) / 44100);
+                combSizes[i] = (intSampleRate * combTunings[i] * ROOM_SCALE) / 44100;
             }
             else
             {
-                comb[i].setSize(
+                combSizes[i] =
                     (intSampleRate * (combTunings[i] * ROOM_SCALE + stereoSpread * ROOM_SCALE)) /
-                    44100);
+                    44100;
             }
         }
+        combs.setSizes(combSizes);
         for (int i = 0; i < numAllPasses; ++i)
         {
             if (left_or_right == LEFT)
@@ -4996,10 +5749,7 @@ class mono_Reverb : RuntimeListener
     }
     COLD void reset() noexcept
     {
-        for (int i = 0; i < numCombs; ++i)
-        {
-            comb[i].clear();
-        }
+        combs.clear();
 
         for (int i = 0; i < numAllPasses; ++i)
         {
@@ -5159,31 +5909,39 @@ class FXProcessor
                     reverb_data->width_smoother.get_smoothed_value_buffer();
                 const float *const smoothed_dry_wet_mix_buffer =
                     reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
+                // UPDATE THE PARAMETERS ONLY ONCE IF THE SMOOTHERS ARE STEADY
+                const bool is_steady = reverb_data->room_smoother.is_constant() and
+                                       reverb_data->width_smoother.is_constant() and
+                                       reverb_data->dry_wet_mix_smoother.is_constant();
                 ReverbParameters &rever_params_l = reverb_l.get_parameters();
                 ReverbParameters &rever_params_r = reverb_r.get_parameters();
                 for (int sid = 0; sid != num_samples_; ++sid)
                 {
                     {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
+                        if (sid == 0 or not is_steady)
                         {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
-
-                            rever_params_r.roomSize = rever_params_l.roomSize;
-                            rever_params_r.dryLevel = rever_params_l.dryLevel;
-                            rever_params_r.wetLevel = rever_params_l.wetLevel;
-                            rever_params_r.width = rever_params_l.width;
-
-                            reverb_l.update_parameters();
-                            reverb_r.update_parameters();
+                            const float reverb_room = smoothed_room_buffer[sid];
+                            const float reverb_dry_wet_mix =
+                                1.0f - smoothed_dry_wet_mix_buffer[sid];
+                            const float reverb_width = smoothed_with_buffer[sid];
+                            if (rever_params_l.roomSize != reverb_room ||
+                                rever_params_l.dryLevel != reverb_dry_wet_mix
+                                //|| rever_params_r.wetLevel != r_params.wetLevel
+                                || rever_params_l.width != reverb_width)
+                            {
+                                rever_params_l.roomSize = reverb_room;
+                                rever_params_l.dryLevel = reverb_dry_wet_mix;
+                                rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
+                                rever_params_l.width = reverb_width;
+
+                                rever_params_r.roomSize = rever_params_l.roomSize;
+                                rever_params_r.dryLevel = rever_params_l.dryLevel;
+                                rever_params_r.wetLevel = rever_params_l.wetLevel;
+                                rever_params_r.width = rever_params_l.width;
+
+                                reverb_l.update_parameters();
+                                reverb_r.update_parameters();
+                            }
                         }
 
                         const float in_l = left_out_buffer[sid];
@@ -5262,11 +6020,7 @@ class FXProcessor
                     }
 
                     // VISUALIZE BEFORE FONAL OUT
-                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
-                    {
-                        ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
-                        meter->process(left_out_buffer, num_samples_);
-                    }
+                    synth_data->audio_processor->process_peak_meter(left_out_buffer, num_samples_);
                     if (is_stereo)
                     {
                         for (int sid = 0; sid != num_samples_; ++sid)
@@ -5350,24 +6104,32 @@ class FXProcessor
                     reverb_data->width_smoother.get_smoothed_value_buffer();
                 const float *const smoothed_dry_wet_mix_buffer =
                     reverb_data->dry_wet_mix_smoother.get_smoothed_value_buffer();
+                // UPDATE THE PARAMETERS ONLY ONCE IF THE SMOOTHERS ARE STEADY
+                const bool is_steady = reverb_data->room_smoother.is_constant() and
+                                       reverb_data->width_smoother.is_constant() and
+                                       reverb_data->dry_wet_mix_smoother.is_constant();
                 ReverbParameters &rever_params_l = reverb_l.get_parameters();
                 for (int sid = 0; sid != num_samples_; ++sid)
                 {
                     {
-                        const float reverb_room = smoothed_room_buffer[sid];
-                        const float reverb_dry_wet_mix = 1.0f - smoothed_dry_wet_mix_buffer[sid];
-                        const float reverb_width = smoothed_with_buffer[sid];
-                        if (rever_params_l.roomSize != reverb_room ||
-                            rever_params_l.dryLevel != reverb_dry_wet_mix
-                            //|| rever_params_r.wetLevel != r_params.wetLevel
-                            || rever_params_l.width != reverb_width)
+                        if (sid == 0 or not is_steady)
                         {
-                            rever_params_l.roomSize = reverb_room;
-                            rever_params_l.dryLevel = reverb_dry_wet_mix;
-                            rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
-                            rever_params_l.width = reverb_width;
+                            const float reverb_room = smoothed_room_buffer[sid];
+                            const float reverb_dry_wet_mix =
+                                1.0f - smoothed_dry_wet_mix_buffer[sid];
+                            const float reverb_width = smoothed_with_buffer[sid];
+                            if (rever_params_l.roomSize != reverb_room ||
+                                rever_params_l.dryLevel != reverb_dry_wet_mix
+                                //|| rever_params_r.wetLevel != r_params.wetLevel
+                                || rever_params_l.width != reverb_width)
+                            {
+                                rever_params_l.roomSize = reverb_room;
+                                rever_params_l.dryLevel = reverb_dry_wet_mix;
+                                rever_params_l.wetLevel = 1.0f - reverb_dry_wet_mix;
+                                rever_params_l.width = reverb_width;
 
-                            reverb_l.update_parameters();
+                                reverb_l.update_parameters();
+                            }
                         }
 
                         const float in_l = left_out_buffer[sid];
@@ -5407,11 +6169,7 @@ class FXProcessor
                     }
 
                     // VISUALIZE BEFORE FONAL OUT
-                    if (Monique_Ui_SegmentedMeter *meter = synth_data->audio_processor->peak_meter)
-                    {
-                        ScopedLock locked(synth_data->audio_processor->peak_meter_lock);
-                        meter->process(left_out_buffer, num_samples_);
-                    }
+                    synth_data->audio_processor->process_peak_meter(left_out_buffer, num_samples_);
                     {
                         for (int sid = 0; sid != num_samples_; ++sid)
                         {
@@ -5796,6 +6554,8 @@ COLD MoniqueSynthesiserVoice::MoniqueSynthesiserVoice(MoniqueAudioProcessor *con
                                    synth_data_->sine_lookup, synth_data_->cos_lookup,
                                    synth_data_->exp_lookup)),
 
+      worker_pool(new mono_WorkerPool(MONIQUE_NUM_WORKER_THREADS)),
+
       current_note(-1), pitch_offset(0),
 
       is_sostenuto_pedal_down(false), stopped_and_sostenuto_pedal_was_down(false),
@@ -5803,7 +6563,8 @@ COLD MoniqueSynthesiserVoice::MoniqueSynthesiserVoice(MoniqueAudioProcessor *con
       is_sustain_pedal_down(false), stopped_and_sustain_pedal_was_down(false),
 
       current_velocity(0), current_step(0), current_running_arp_step(0),
-      an_arp_note_is_already_running(false), sample_position_for_restart_arp(-1)
+      an_arp_note_is_already_running(false), sample_position_for_restart_arp(-1),
+      note_on_sample_position(0)
 {
 #ifdef JUCE_DEBUG
     std::cout << "MONIQUE: init BUFFERS's" << std::endl;
@@ -5858,6 +6619,8 @@ COLD MoniqueSynthesiserVoice::~MoniqueSynthesiserVoice() noexcept
 #ifdef JUCE_DEBUG
     std::cout << "~MoniqueSynthesiserVoice" << std::endl;
 #endif
+    delete worker_pool;
+
     for (int i = SUM_FILTERS - 1; i > -1; --i)
     {
 #ifdef POLY
@@ -5890,7 +6653,7 @@ COLD MoniqueSynthesiserVoice::~MoniqueSynthesiserVoice() noexcept
 void MoniqueSynthesiserVoice::startNote(int midi_note_number_, float velocity_,
                                         SynthesiserSound * /*sound*/, int pitch_)
 {
-    start_internal(midi_note_number_, velocity_, 0, true);
+    start_internal(midi_note_number_, velocity_, note_on_sample_position, true);
 }
 void MoniqueSynthesiserVoice::start_internal(int midi_note_number_, float velocity_,
                                              int sample_number_, bool is_human_event_,
@@ -6836,6 +7599,12 @@ void MoniqueSynthesiserVoice::renderNextBlock(AudioSampleBuffer &output_buffer_,
     {
         info->relative_samples_since_start = info->samples_since_start;
     }
+    else
+    {
+        // THE SYNTHESIZER SPLITS THE BLOCK AT MIDI EVENTS, start_sample_ IS RELATIVE TO THE
+        // BLOCK START
+        info->relative_samples_since_start -= start_sample_;
+    }
 
     int count_start_sample = start_sample_;
     int counted_samples = num_samples_;
@@ -6913,7 +7682,7 @@ void MoniqueSynthesiserVoice::renderNextBlock(AudioSampleBuffer &output_buffer_,
 
     if (!audio_processor->get_current_pos_info().isPlaying)
     {
-        info->relative_samples_since_start += num_samples_;
+        info->relative_samples_since_start += start_sample_ + num_samples_;
     }
 }
 
@@ -6924,20 +7693,41 @@ inline void SmoothManager::smooth_and_morph(bool force_by_load_, bool is_automat
                                             MorphGroup *morph_group_) noexcept
 {
     // PROCESS THE MORPH
-    for (int i = 0; i != smoothers.size(); ++i)
-    {
-        SmoothedParameter *param = smoothers.getUnchecked(i);
-        const int index = morph_group_->indexOf(param->param_to_smooth);
-        if (index != -1)
-        {
-            if (param->param_to_smooth->get_runtime_info().smoothing_is_enabled)
+    // THE SOURCES OF THE BLOCK, SEE MoniqueSynthesiserVoice::render_block
+    const float *const snapshot = morph_group_->snapshot->get();
+    const float *const left_values = snapshot + morph_group_->left_values_offset;
+    const float *const right_values = snapshot + morph_group_->right_values_offset;
+    const float *const left_modulations = snapshot + morph_group_->left_modulations_offset;
+    const float *const right_modulations = snapshot + morph_group_->right_modulations_offset;
+    const float power_of_right = snapshot[morph_group_->power_of_right_offset];
+
+    // A SYNC MORPH GIVES BOTH SIDES THE SAME TARGET, THE MORPH POWER DOES NOT MATTER THEN
+    const bool is_sync_morph =
+        morph_group_->process_sync_morph(snapshot, num_samples_, sample_rate);
+    const float *const sync_values = morph_group_->get_sync_values();
+    const float *const sync_modulations = morph_group_->get_sync_modulations();
+
+    const Array<MorphGroup::SmoothedMorphParameter> &params = morph_group_->get_smoothed_params();
+    for (int i = 0; i != params.size(); ++i)
+    {
+        const MorphGroup::SmoothedMorphParameter &param = params.getReference(i);
+        if (param.smoother->param_to_smooth->get_runtime_info().smoothing_is_enabled)
+        {
+            if (is_sync_morph)
+            {
+                param.smoother->smooth_and_morph(
+                    force_by_load_, is_automated_morph_, smooth_motor_time_in_ms_,
+                    morph_motor_time_in_ms_, morph_power_buffer_, power_of_right,
+                    sync_values[param.index], sync_values[param.index],
+                    sync_modulations[param.index], sync_modulations[param.index], num_samples_);
+            }
+            else
             {
-                const Parameter *left_param = morph_group_->get_left_param(index);
-                const Parameter *right_param = morph_group_->get_right_param(index);
-                param->smooth_and_morph(force_by_load_, is_automated_morph_,
-                                        smooth_motor_time_in_ms_, morph_motor_time_in_ms_,
-                                        morph_power_buffer_, morph_group_->last_power_of_right,
-                                        left_param, right_param, num_samples_);
+                param.smoother->smooth_and_morph(
+                    force_by_load_, is_automated_morph_, smooth_motor_time_in_ms_,
+                    morph_motor_time_in_ms_, morph_power_buffer_, power_of_right,
+                    left_values[param.index], right_values[param.index],
+                    left_modulations[param.index], right_modulations[param.index], num_samples_);
             }
         }
     }
@@ -6960,51 +7750,105 @@ inline void SmoothManager::smooth_and_morph(bool force_by_load_, bool is_automat
 // TOOPT
 #define FORCE_MIN_MAX(x) jmax(jmin(x, max_value), min_value)
 
-void SmoothedParameter::simple_smooth(int smooth_motor_time_in_ms_, int num_samples_) noexcept
+//==============================================================================
+// THE SMOOTHERS WRITE THROUGH THESE CHUNKS ON THE STACK, SAFE FOR ANY BLOCK SIZE AND THREAD
+#define SMOOTHING_CHUNK_SIZE 64
+
+static inline void clamp_block(float *io_, float min_, float max_, int num_samples_) noexcept
 {
-    simple_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    simple_smoother.set_value(param_to_smooth->get_value());
-    float *const target = values.getWritePointer();
-    if (not simple_smoother.is_up_to_date())
+    int sid = 0;
+    for (; sid <= num_samples_ - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+    {
+        simd_clamp(mono_float4::load(io_ + sid), min_, max_).store(io_ + sid);
+    }
+    for (; sid < num_samples_; ++sid)
+    {
+        io_[sid] = jmax(jmin(io_[sid], max_), min_);
+    }
+}
+// LEFT * (1 - POWER OF RIGHT) + RIGHT * POWER OF RIGHT
+static inline void morph_block(float *dest_, const float *left_, const float *right_,
+                               const float *power_of_right_, int num_samples_) noexcept
+{
+    const mono_float4 one = mono_float4::broadcast(1.0f);
+    int sid = 0;
+    for (; sid <= num_samples_ - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+    {
+        const mono_float4 power_of_right = mono_float4::load(power_of_right_ + sid);
+        (mono_float4::load(left_ + sid) * (one - power_of_right) +
+         mono_float4::load(right_ + sid) * power_of_right)
+            .store(dest_ + sid);
+    }
+    for (; sid < num_samples_; ++sid)
     {
+        dest_[sid] =
+            left_[sid] * (1.0f - power_of_right_[sid]) + right_[sid] * power_of_right_[sid];
+    }
+}
 
-        for (int sid = 0; sid != num_samples_; ++sid)
-        {
-            target[sid] = FORCE_MIN_MAX(simple_smoother.tick());
-        }
+inline void SmoothedParameter::set_constant_values(float value_) noexcept
+{
+    if (not values_are_constant or constant_value != value_)
+    {
+        FloatVectorOperations::fill(values.getWritePointer(), value_, block_size);
+        values_are_constant = true;
+        constant_value = value_;
+    }
+}
+inline void SmoothedParameter::set_constant_modulation(float value_) noexcept
+{
+    if (not modulation_is_constant or constant_modulation != value_)
+    {
+        FloatVectorOperations::fill(modulation_power.getWritePointer(), value_, block_size);
+        modulation_is_constant = true;
+        constant_modulation = value_;
+    }
+}
 
-        simple_smoother.set_info_flag(false);
+//==============================================================================
+void SmoothedParameter::simple_smooth(int smooth_motor_time_in_ms_, int num_samples_) noexcept
+{
+    simple_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+    simple_smoother.set_value(snapshot ? snapshot->get()[value_offset]
+                                       : param_to_smooth->get_value());
+    if (simple_smoother.is_steady())
+    {
+        set_constant_values(FORCE_MIN_MAX(simple_smoother.get_last_value()));
     }
     else
     {
-        if (not simple_smoother.get_info_flag())
-        {
-            FloatVectorOperations::fill(target, simple_smoother.get_last_value(), block_size);
-
-            simple_smoother.set_info_flag(true);
-        }
+        float *const target = values.getWritePointer();
+        simple_smoother.process(target, num_samples_);
+        clamp_block(target, min_value, max_value, num_samples_);
+        values_are_constant = false;
     }
 
-    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
+    param_to_smooth->get_runtime_info().set_last_value_state(
+        values.getReadPointer()[num_samples_ - 1]);
 }
 // TOOPD FloatVectorOperations
 void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_morph_,
                                          int smooth_motor_time_in_ms_, int morph_motor_time_in_ms_,
                                          const float *morph_amp_buffer_, float morph_slider_state_,
-                                         const Parameter *left_source_param_,
-                                         const Parameter *right_source_param_,
+                                         float left_value_, float right_value_,
+                                         float left_modulation_, float right_modulation_,
                                          int num_samples_) noexcept
 {
-    left_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    right_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    morph_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+    if (smooth_motor_time_in_ms != smooth_motor_time_in_ms_)
+    {
+        smooth_motor_time_in_ms = smooth_motor_time_in_ms_;
 
-    left_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    right_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        left_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        right_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        morph_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
 
-    // LOOKING FORWART TO PROCESS MODUALATION AND AMP MODUALATION
-    modulation_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
-    amp_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        left_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        right_modulation_morph_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+
+        // LOOKING FORWART TO PROCESS MODUALATION AND AMP MODUALATION
+        modulation_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+        amp_power_smoother.reset_coefficients(sample_rate, smooth_motor_time_in_ms_);
+    }
 
     if (force_by_load_)
     {
@@ -7014,89 +7858,95 @@ void SmoothedParameter::smooth_and_morph(bool force_by_load_, bool is_automated_
     }
 
     const bool is_modulateable = has_modulation(param_to_smooth);
-    float *const target = values.getWritePointer();
-    if (not is_modulateable)
+    left_morph_smoother.set_value(left_value_);
+    right_morph_smoother.set_value(right_value_);
+    if (is_modulateable)
     {
-        left_morph_smoother.set_value(left_source_param_->get_value());
-        right_morph_smoother.set_value(right_source_param_->get_value());
+        left_modulation_morph_smoother.set_value(left_modulation_);
+        right_modulation_morph_smoother.set_value(right_modulation_);
+    }
+    // USER MORPH
+    if (not is_automated_morph_)
+    {
+        morph_power_smoother.set_value(morph_slider_state_);
+    }
 
-        // AUTOMATED MORPH
-        if (is_automated_morph_)
-        {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
-            }
-        }
-        // USER MORPH
-        else
+    // NOTHING MOVES, THE BUFFERS ARE WRITTEN ONLY IF THE VALUE HAS CHANGED
+    if (not is_automated_morph_ and morph_power_smoother.is_steady() and
+        left_morph_smoother.is_steady() and right_morph_smoother.is_steady() and
+        (not is_modulateable or (left_modulation_morph_smoother.is_steady() and
+                                 right_modulation_morph_smoother.is_steady())))
+    {
+        const float power_of_right = morph_power_smoother.get_last_value();
+        set_constant_values(
+            FORCE_MIN_MAX(left_morph_smoother.get_last_value() * (1.0f - power_of_right) +
+                          right_morph_smoother.get_last_value() * power_of_right));
+        if (is_modulateable)
         {
-            morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right = morph_power_smoother.tick();
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
-            }
-
-            // KEEP UP TO DATE FOR A SWITCH
-            morph_power_smoother.reset_glide_countdown();
+            set_constant_modulation(left_modulation_morph_smoother.get_last_value() *
+                                        (1.0f - power_of_right) +
+                                    right_modulation_morph_smoother.get_last_value() *
+                                        power_of_right);
         }
     }
-    // ITS A COPY OF THE PROCESS ABOVE BUT WITH MODULATION
     else
     {
-        left_morph_smoother.set_value(left_source_param_->get_value());
-        right_morph_smoother.set_value(right_source_param_->get_value());
-
-        left_modulation_morph_smoother.set_value(left_source_param_->get_modulation_amount());
-        right_modulation_morph_smoother.set_value(right_source_param_->get_modulation_amount());
-
-        // AUTOMATED MORPH
+        float *const target = values.getWritePointer();
         float *const target_modulation = modulation_power.getWritePointer();
-        if (is_automated_morph_)
+        float left[SMOOTHING_CHUNK_SIZE];
+        float right[SMOOTHING_CHUNK_SIZE];
+        float power_of_right[SMOOTHING_CHUNK_SIZE];
+        for (int start = 0; start < num_samples_; start += SMOOTHING_CHUNK_SIZE)
         {
-            for (int sid = 0; sid != num_samples_; ++sid)
-            {
-                const float power_of_right_ =
-                    morph_power_smoother.glide_tick(morph_amp_buffer_[sid]);
+            const int num_samples = jmin(SMOOTHING_CHUNK_SIZE, num_samples_ - start);
 
-                // VALUE
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right_) +
-                                            right_morph_smoother.tick() * power_of_right_);
-                // MODULATION
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right_) +
-                    right_modulation_morph_smoother.tick() * power_of_right_;
+            // AUTOMATED MORPH
+            if (is_automated_morph_)
+            {
+                for (int sid = 0; sid != num_samples; ++sid)
+                {
+                    power_of_right[sid] =
+                        morph_power_smoother.glide_tick(morph_amp_buffer_[start + sid]);
+                }
             }
-        }
-        // USER MORPH
-        else
-        {
-            morph_power_smoother.set_value(morph_slider_state_);
-            for (int sid = 0; sid != num_samples_; ++sid)
+            // USER MORPH
+            else
             {
-                const float power_of_right = morph_power_smoother.tick();
-                // VALUE BLOCK
-                target[sid] = FORCE_MIN_MAX(left_morph_smoother.tick() * (1.0f - power_of_right) +
-                                            right_morph_smoother.tick() * power_of_right);
-                // MODULATION BLOCK
-                target_modulation[sid] =
-                    left_modulation_morph_smoother.tick() * (1.0f - power_of_right) +
-                    right_modulation_morph_smoother.tick() * power_of_right;
+                morph_power_smoother.process(power_of_right, num_samples);
             }
 
-            // KEEP UP TO DATE FOR A SWITCH
-            morph_power_smoother.reset_glide_countdown();
+            // VALUE
+            left_morph_smoother.process(left, num_samples);
+            right_morph_smoother.process(right, num_samples);
+            morph_block(target + start, left, right, power_of_right, num_samples);
+            clamp_block(target + start, min_value, max_value, num_samples);
+
+            // MODULATION
+            if (is_modulateable)
+            {
+                left_modulation_morph_smoother.process(left, num_samples);
+                right_modulation_morph_smoother.process(right, num_samples);
+                morph_block(target_modulation + start, left, right, power_of_right, num_samples);
+            }
         }
-        param_to_smooth->get_runtime_info().set_last_modulation_state(
-            target_modulation[num_samples_ - 1]);
+
+        values_are_constant = false;
+        modulation_is_constant = false;
     }
 
-    param_to_smooth->get_runtime_info().set_last_value_state(target[num_samples_ - 1]);
+    // KEEP UP TO DATE FOR A SWITCH
+    if (not is_automated_morph_)
+    {
+        morph_power_smoother.reset_glide_countdown();
+    }
+
+    if (is_modulateable)
+    {
+        param_to_smooth->get_runtime_info().set_last_modulation_state(
+            modulation_power.getReadPointer()[num_samples_ - 1]);
+    }
+    param_to_smooth->get_runtime_info().set_last_value_state(
+        values.getReadPointer()[num_samples_ - 1]);
 }
 // TOOPD FloatVectorOperations
 inline void SmoothedParameter::process_modulation(const bool is_modulated_,
@@ -7129,6 +7979,7 @@ inline void SmoothedParameter::process_modulation(const bool is_modulated_,
         }
 
         param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
+        values_are_constant = false;
     }
     else
     {
@@ -7152,6 +8003,7 @@ inline void SmoothedParameter::process_modulation(const bool is_modulated_,
                     DEBUG_CHECK_MIN_MAX(source_and_target[sid]);
                 }
             }
+            values_are_constant = false;
         }
 
         param_to_smooth->get_runtime_info().set_last_modulation_amount(current_modulation_power);
@@ -7250,6 +8102,9 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
         const int glide_motor_time = synth_data->glide_motor_time;
         const int morph_motor_time = synth_data->morph_motor_time;
 
+        // ONE CONSISTENT STATE OF THE MORPH SOURCES FOR THE WHOLE BLOCK
+        synth_data->morph_snapshot.update();
+
         // WORKAROUND TO UPDATE THE MORPH GROUPS
         const bool force_by_load = synth_data->force_morph_update__load_flag;
         synth_data->force_morph_update__load_flag = false;
@@ -7315,7 +8170,10 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
 
                 const bool force_by_load;
 
-                void exec() noexcept
+                // THE LANES RUN IN THREE PHASES, THE TASKS OF A PHASE ARE INDEPENDENT:
+                // EVERY PARAMETER IS IN ONE MORPH GROUP ONLY, THE LFOS AND FILTER ENVS READ
+                // MORPH GROUP 2 AND THE SECOND AND THIRD OSC READ OSC 0
+                void exec_morph() noexcept
                 {
                     mfo_data->wave_smoother.simple_smooth(glide_motor_time, num_samples);
                     mfo_data->phase_shift_smoother.simple_smooth(glide_motor_time, num_samples);
@@ -7325,7 +8183,9 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
                     synth_data->smooth_manager->smooth_and_morph(
                         force_by_load, is_modulated, mfo_buffer, num_samples, glide_motor_time,
                         morph_motor_time, morph_group);
-
+                }
+                void exec_modulation() noexcept
+                {
                     if (lfo)
                     {
                         lfo->process(lfo_buffer, step_number, absolute_step_number, start_sample,
@@ -7335,16 +8195,32 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
                     {
                         master_osc->process(synth_data->data_buffer, num_samples); // NEED LFO 0
                     }
-                    if (second_osc)
+                    if (filter_env)
                     {
-                        second_osc->process(synth_data->data_buffer, num_samples); // NEED LFO 0
+                        filter_env->process(filter_env_buffer, num_samples);
                     }
-                    if (filter_env)
+                }
+                void exec_osc() noexcept
+                {
+                    if (second_osc)
                     {
-                        filter_env->process(filter_env_buffer, num_samples); // NEED LFO 0
+                        second_osc->process(synth_data->data_buffer, num_samples); // NEED OSC 0
                     }
                 }
 
+                static void morph_task(void *executers_, int id_) noexcept
+                {
+                    static_cast<SmoothExecuter *>(executers_)[id_].exec_morph();
+                }
+                static void modulation_task(void *executers_, int id_) noexcept
+                {
+                    static_cast<SmoothExecuter *>(executers_)[id_].exec_modulation();
+                }
+                static void osc_task(void *executers_, int id_) noexcept
+                {
+                    static_cast<SmoothExecuter *>(executers_)[id_].exec_osc();
+                }
+
                 SmoothExecuter(MoniqueSynthesiserVoice *const voice_, float *const mfo_buffer_,
                                float *const lfo_buffer_,
 
@@ -7384,85 +8260,82 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
                 ~SmoothExecuter() noexcept {}
             };
 
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
-                           data_buffer->lfo_amplitudes.getWritePointer(0),
+            SmoothExecuter executers[SUM_MORPHER_GROUPS] = {
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
+                               data_buffer->lfo_amplitudes.getWritePointer(0),
+
+                               mfos[0], lfos[0], master_osc, nullptr,
 
-                           mfos[0], lfos[0], master_osc, nullptr,
+                               filter_processors[0]->env, // FIRST WILL BE DONE BY THE LAST THREAD
+                               data_buffer->filter_env_amps.getWritePointer(0),
 
-                           filter_processors[0]->env, // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(0),
+                               synth_data->morph_group_1, synth_data->mfo_datas[0], synth_data,
 
-                           synth_data->morph_group_1, synth_data->mfo_datas[0], synth_data,
+                               synth_data->is_morph_modulated[0],
 
-                           synth_data->is_morph_modulated[0],
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               glide_motor_time, morph_motor_time,
 
-                           glide_motor_time, morph_motor_time,
+                               force_by_load),
 
-                           force_by_load)
-                .exec();
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
+                               data_buffer->lfo_amplitudes.getWritePointer(1),
 
-            // OPTIONAL THREAD WITH FILTER 1
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
-                           data_buffer->lfo_amplitudes.getWritePointer(1),
+                               mfos[1], lfos[1], nullptr,
+                               second_osc, // NEED OSC
 
-                           mfos[1], lfos[1], nullptr,
-                           second_osc, // NEED OSC
+                               filter_processors[1]->env, // FIRST WILL BE DONE BY THE LAST THREAD
+                               data_buffer->filter_env_amps.getWritePointer(1),
 
-                           filter_processors[1]->env, // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(1),
+                               synth_data->morph_group_2, synth_data->mfo_datas[1], synth_data,
 
-                           synth_data->morph_group_2, synth_data->mfo_datas[1], synth_data,
+                               synth_data->is_morph_modulated[1],
 
-                           synth_data->is_morph_modulated[1],
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               glide_motor_time, morph_motor_time,
 
-                           glide_motor_time, morph_motor_time,
+                               force_by_load),
 
-                           force_by_load)
-                .exec();
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
+                               data_buffer->lfo_amplitudes.getWritePointer(2),
 
-            // OPTIONAL THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
-                           data_buffer->lfo_amplitudes.getWritePointer(2),
+                               mfos[2], lfos[2], nullptr,
+                               third_osc, // NEED OSC 0
 
-                           mfos[2], lfos[2], nullptr,
-                           third_osc, // NEED OSC 0
+                               filter_processors[2]->env,
+                               data_buffer->filter_env_amps.getWritePointer(2),
 
-                           filter_processors[2]->env,
-                           data_buffer->filter_env_amps.getWritePointer(2),
+                               synth_data->morph_group_3, synth_data->mfo_datas[2], synth_data,
 
-                           synth_data->morph_group_3, synth_data->mfo_datas[2], synth_data,
+                               synth_data->is_morph_modulated[2],
 
-                           synth_data->is_morph_modulated[2],
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               glide_motor_time, morph_motor_time,
 
-                           glide_motor_time, morph_motor_time,
+                               force_by_load),
 
-                           force_by_load)
-                .exec();
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
 
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
+                               mfos[3], nullptr, nullptr, nullptr,
 
-                           mfos[3], nullptr, nullptr, nullptr,
+                               nullptr, nullptr,
 
-                           nullptr, nullptr,
+                               synth_data->morph_group_4, synth_data->mfo_datas[3], synth_data,
 
-                           synth_data->morph_group_4, synth_data->mfo_datas[3], synth_data,
+                               synth_data->is_morph_modulated[3],
 
-                           synth_data->is_morph_modulated[3],
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               glide_motor_time, morph_motor_time,
 
-                           glide_motor_time, morph_motor_time,
+                               force_by_load)};
 
-                           force_by_load)
-                .exec();
+            worker_pool->run(&SmoothExecuter::morph_task, executers, SUM_MORPHER_GROUPS);
+            worker_pool->run(&SmoothExecuter::modulation_task, executers, SUM_FILTERS);
+            worker_pool->run(&SmoothExecuter::osc_task, executers + 1, 2);
 
             // WITH THREADING INSIDE
             filter_processors[0]->process(num_samples);
@@ -7503,6 +8376,9 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
         const int glide_motor_time = synth_data->glide_motor_time;
         const int morph_motor_time = synth_data->morph_motor_time;
 
+        // ONE CONSISTENT STATE OF THE MORPH SOURCES FOR THE WHOLE BLOCK
+        synth_data->morph_snapshot.update();
+
         // WORKAROUND TO UPDATE THE MORPH GROUPS
         const bool force_by_load = synth_data->force_morph_update__load_flag;
         synth_data->force_morph_update__load_flag = false;
@@ -7553,7 +8429,7 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
 
                 const bool force_by_load;
 
-                void exec() noexcept
+                void exec_morph() noexcept
                 {
                     mfo_data->wave_smoother.simple_smooth(glide_motor_time, num_samples);
                     mfo_data->phase_shift_smoother.simple_smooth(glide_motor_time, num_samples);
@@ -7621,87 +8497,87 @@ void MoniqueSynthesiserVoice::render_block(AudioSampleBuffer &output_buffer_, in
                 {
                 }
                 ~SmoothExecuter() noexcept {}
+
+                static void morph_task(void *executers_, int id_) noexcept
+                {
+                    static_cast<SmoothExecuter *>(executers_)[id_].exec_morph();
+                }
             };
 
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
-                           data_buffer->lfo_amplitudes.getWritePointer(0),
+            SmoothExecuter executers[SUM_MORPHER_GROUPS] = {
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(0),
+                               data_buffer->lfo_amplitudes.getWritePointer(0),
 
-                           mfos[0], lfos[0], master_osc, nullptr,
+                               mfos[0], lfos[0], master_osc, nullptr,
 
-                           filter_processors[0]->env, // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(0),
+                               filter_processors[0]->env, // FIRST WILL BE DONE BY THE LAST THREAD
+                               data_buffer->filter_env_amps.getWritePointer(0),
 
-                           synth_data->morph_group_1, synth_data->mfo_datas[0], synth_data,
+                               synth_data->morph_group_1, synth_data->mfo_datas[0], synth_data,
 
-                           synth_data->is_morph_modulated[0],
+                               synth_data->is_morph_modulated[0],
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           glide_motor_time, morph_motor_time,
+                               glide_motor_time, morph_motor_time,
 
-                           force_by_load)
-                .exec();
+                               force_by_load),
 
-            // OPTIONAL THREAD WITH FILTER 1
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
-                           data_buffer->lfo_amplitudes.getWritePointer(1),
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(1),
+                               data_buffer->lfo_amplitudes.getWritePointer(1),
 
-                           mfos[1], lfos[1], nullptr,
-                           second_osc, // NEED OSC
+                               mfos[1], lfos[1], nullptr,
+                               second_osc, // NEED OSC
 
-                           filter_processors[1]->env, // FIRST WILL BE DONE BY THE LAST THREAD
-                           data_buffer->filter_env_amps.getWritePointer(1),
+                               filter_processors[1]->env, // FIRST WILL BE DONE BY THE LAST THREAD
+                               data_buffer->filter_env_amps.getWritePointer(1),
 
-                           synth_data->morph_group_2, synth_data->mfo_datas[1], synth_data,
+                               synth_data->morph_group_2, synth_data->mfo_datas[1], synth_data,
 
-                           synth_data->is_morph_modulated[1],
+                               synth_data->is_morph_modulated[1],
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           glide_motor_time, morph_motor_time,
+                               glide_motor_time, morph_motor_time,
 
-                           force_by_load)
-                .exec();
+                               force_by_load),
 
-            // OPTIONAL THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
-                           data_buffer->lfo_amplitudes.getWritePointer(2),
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(2),
+                               data_buffer->lfo_amplitudes.getWritePointer(2),
 
-                           mfos[2], lfos[2], nullptr,
-                           third_osc, // NEED OSC 0
+                               mfos[2], lfos[2], nullptr,
+                               third_osc, // NEED OSC 0
 
-                           filter_processors[2]->env,
-                           data_buffer->filter_env_amps.getWritePointer(2),
+                               filter_processors[2]->env,
+                               data_buffer->filter_env_amps.getWritePointer(2),
 
-                           synth_data->morph_group_3, synth_data->mfo_datas[2], synth_data,
+                               synth_data->morph_group_3, synth_data->mfo_datas[2], synth_data,
 
-                           synth_data->is_morph_modulated[2],
+                               synth_data->is_morph_modulated[2],
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           glide_motor_time, morph_motor_time,
+                               glide_motor_time, morph_motor_time,
 
-                           force_by_load)
-                .exec();
+                               force_by_load),
 
-            // MASTER THREAD
-            SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
+                SmoothExecuter(this, data_buffer->mfo_amplitudes.getWritePointer(3), nullptr,
 
-                           mfos[3], nullptr, nullptr, nullptr,
+                               mfos[3], nullptr, nullptr, nullptr,
 
-                           nullptr, nullptr,
+                               nullptr, nullptr,
 
-                           synth_data->morph_group_4, synth_data->mfo_datas[3], synth_data,
+                               synth_data->morph_group_4, synth_data->mfo_datas[3], synth_data,
 
-                           synth_data->is_morph_modulated[3],
+                               synth_data->is_morph_modulated[3],
 
-                           step_number_, absolute_step_number_, start_sample_, num_samples,
+                               step_number_, absolute_step_number_, start_sample_, num_samples,
 
-                           glide_motor_time, morph_motor_time,
+                               glide_motor_time, morph_motor_time,
 
-                           force_by_load)
-                .exec();
+                               force_by_load)};
+
+            worker_pool->run(&SmoothExecuter::morph_task, executers, SUM_MORPHER_GROUPS);
         }
 
         if (not bypass_smoother.get_info_flag())
@@ -7813,6 +8689,14 @@ void MoniqueSynthesiserVoice::clear_record_buffer() noexcept
 {
     fx_processor->delay.clear_record_buffer();
 }
+COLD void MoniqueSynthesiserVoice::set_num_worker_threads(int num_threads_) noexcept
+{
+    worker_pool->set_num_workers(num_threads_);
+}
+int MoniqueSynthesiserVoice::get_num_worker_threads() const noexcept
+{
+    return worker_pool->get_num_workers();
+}
 float MoniqueSynthesiserVoice::get_filter_env_amp(int filter_id_) const noexcept
 {
     return filter_processors[filter_id_]->env->get_amp();
@@ -7853,6 +8737,24 @@ void MoniqueSynthesizer::handleSostenutoPedal(int, bool isDown)
 }
 
 void MoniqueSynthesizer::handleSoftPedal(int, bool isDown) { voice->handle_soft_pedal(isDown); }
+
+//==============================================================================
+void MoniqueSynthesizer::set_control_rate(int num_samples_, bool is_cubic_) noexcept
+{
+    synth_data->control_rate_is_cubic.store(is_cubic_, std::memory_order_relaxed);
+    synth_data->control_rate.store(jlimit(1, MONIQUE_MAX_CONTROL_RATE, num_samples_),
+                                   std::memory_order_relaxed);
+}
+int MoniqueSynthesizer::get_control_rate() const noexcept
+{
+    return synth_data->control_rate.load(std::memory_order_relaxed);
+}
+bool MoniqueSynthesizer::is_control_rate_cubic() const noexcept
+{
+    return synth_data->control_rate_is_cubic.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
 void MoniqueSynthesizer::handleBankSelect(int controllerValue) noexcept
 {
     synth_data->set_current_bank(jmin(25, controllerValue));
@@ -7901,14 +8803,30 @@ void MoniqueSynthesizer::handleController(int midiChannel, int cc_number_, int c
         // CONTROLL
         if (not learing_param)
         {
-            for (int i = 0; i != paramters.size(); ++i)
+            const int controller_number = midiChannel == 2 ? cc_number_ + 128 : cc_number_;
+            MIDIControl *const *route = midi_control_handler->get_route(controller_number);
+            if (route)
             {
-                Parameter *const param = paramters.getUnchecked(i);
-                if (param->midi_control->read_from_if_you_listen(
-                        midiChannel == 2 ? cc_number_ + 128 : cc_number_, cc_value_,
-                        synth_data->midi_pickup_offset))
+                while (MIDIControl *const midi_control = *route++)
                 {
-                    break;
+                    if (midi_control->read_from_if_you_listen(controller_number, cc_value_,
+                                                              synth_data->midi_pickup_offset))
+                    {
+                        break;
+                    }
+                }
+            }
+            // MORE CONTROLS THAN THE ROUTE CAN HOLD
+            else
+            {
+                for (int i = 0; i != paramters.size(); ++i)
+                {
+                    Parameter *const param = paramters.getUnchecked(i);
+                    if (param->midi_control->read_from_if_you_listen(
+                            controller_number, cc_value_, synth_data->midi_pickup_offset))
+                    {
+                        break;
+                    }
                 }
             }
         }
@@ -8340,8 +9258,10 @@ void MoniqueSynthesizer::process_next_block(AudioBuffer<float> &outputAudio,
 
     int midiEventPos;
     MidiMessage m;
+    bool is_first_event = true;
 
-    const ScopedLock sl(lock);
+    // NO LOCK: THE UI TALKS TO THE SYNTH THROUGH THE QUEUES OF THE PROCESSOR, THE LOCKS OF
+    // juce::Synthesiser ARE ONLY TAKEN BY THE AUDIO THREAD AND NEVER CONTENDED
 
     int program_chnage_counter_temp = synth_data->changed_programm;
     if (program_chnage_counter_temp != program_chnage_counter)
@@ -8434,18 +9354,15 @@ void MoniqueSynthesizer::process_next_block(AudioBuffer<float> &outputAudio,
             break;
         }
 
-        // FIXME - what was the intent here?
-        {
-            static bool fix_oss_port_issue = false;
-            jassert(fix_oss_port_issue);
-            fix_oss_port_issue = true;
-        }
-        // if (samplesToNextMidiMessage < minimumSubBlockSize)
+        // TOO SHORT TO SPLIT: HANDLE IT AT THE CURRENT POSITION, EVENTS AT THE BLOCK START ARE
+        // ALWAYS HANDLED BEFORE THE RENDERING
+        if (samplesToNextMidiMessage < (is_first_event ? 1 : minimum_sub_block_size))
         {
-            handle_midi_event(m, midiEventPos);
+            handle_midi_event(m, startSample);
             continue;
         }
 
+        is_first_event = false;
         renderVoices(outputAudio, startSample, samplesToNextMidiMessage);
         handle_midi_event(m, midiEventPos);
         startSample += samplesToNextMidiMessage;
@@ -8461,6 +9378,7 @@ void MoniqueSynthesizer::process_next_block(AudioBuffer<float> &outputAudio,
 void MoniqueSynthesizer::handle_midi_event(const MidiMessage &m, int pos_in_buffer_)
 {
     const int channel = m.getChannel();
+    voice->note_on_sample_position = pos_in_buffer_;
 
     if (m.isNoteOn())
     {
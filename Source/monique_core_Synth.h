@@ -25,6 +25,7 @@ class MoniqueAudioProcessor;
 
 class MoniqueSynthData;
 class RuntimeInfo;
+class mono_WorkerPool;
 class LFO;
 class MFO;
 class SecondOSC;
@@ -39,9 +40,12 @@ class SmoothManager;
 class RuntimeNotifyer;
 class MoniqueSynthesizer;
 
-#define TABLESIZE_MULTI 1000
-//#define LOOKUP_TABLE_SIZE int(float_Pi*TABLESIZE_MULTI*2)
-static const int LOOKUP_TABLE_SIZE = int(float_Pi * TABLESIZE_MULTI * 2);
+// LOOKUP TABLES: ONE PERIOD (0 - 2*PI) IN A POWER OF TWO SIZE PLUS ONE GUARD VALUE FOR THE
+// INTERPOLATION. INDEXES WRAP WITH THE MASK.
+#define LOOKUP_TABLE_BITS 12
+static const int LOOKUP_TABLE_SIZE = 1 << LOOKUP_TABLE_BITS;
+static const int LOOKUP_TABLE_MASK = LOOKUP_TABLE_SIZE - 1;
+static const double LOOKUP_TABLE_SCALE = LOOKUP_TABLE_SIZE / (double_Pi * 2);
 static const double double_Pi_2 = double_Pi * 2;
 class MoniqueSynthesiserVoice : public SynthesiserVoice
 {
@@ -77,6 +81,9 @@ class MoniqueSynthesiserVoice : public SynthesiserVoice
     ENV **filter_volume_tracking_envs;
 #endif
 
+    // RUNS THE INDEPENDENT PARTS OF THE MORPH, MODULATION AND OSC LANES CONCURRENTLY
+    mono_WorkerPool *const worker_pool;
+
     //==============================================================================
     friend MoniqueSynthesizer;
     int current_note;
@@ -92,6 +99,7 @@ class MoniqueSynthesiserVoice : public SynthesiserVoice
     int current_running_arp_step;
     bool an_arp_note_is_already_running;
     int sample_position_for_restart_arp;
+    int note_on_sample_position; // SET BY THE SYNTHESIZER, startNote HAS NO POSITION
 
     //==============================================================================
     bool canPlaySound(SynthesiserSound *) override { return true; }
@@ -144,6 +152,10 @@ class MoniqueSynthesiserVoice : public SynthesiserVoice
     void handle_soft_pedal(bool down_) noexcept;
     void clear_record_buffer() noexcept;
 
+    // 0 RUNS EVERYTHING ON THE AUDIO THREAD, NOT WHILE PROCESSING
+    COLD void set_num_worker_threads(int num_threads_) noexcept;
+    int get_num_worker_threads() const noexcept;
+
   public:
     //==============================================================================
     // UI INFOS
@@ -174,6 +186,19 @@ inline float MoniqueSynthesiserVoice::get_current_velocity() const noexcept
 //==============================================================================
 //==============================================================================
 //==============================================================================
+// EVENTS CLOSER THAN THIS TO THE LAST SPLIT ARE HANDLED AT THE SPLIT
+#ifndef MONIQUE_MIN_SUB_BLOCK_SIZE
+#define MONIQUE_MIN_SUB_BLOCK_SIZE 32
+#endif
+// THREADS NEXT TO THE AUDIO THREAD FOR THE VOICE LANES, LIMITED TO THE NUMBER OF CPUS - 1. OFF
+// BY DEFAULT, EVERY INSTANCE HAS ITS OWN POOL AND THE WORKERS ARE NO REAL TIME THREADS.
+#ifndef MONIQUE_NUM_WORKER_THREADS
+#define MONIQUE_NUM_WORKER_THREADS 0
+#endif
+// MAX SAMPLES PER STEP OF THE MODULATION SOURCES IN CONTROL RATE MODE
+#ifndef MONIQUE_MAX_CONTROL_RATE
+#define MONIQUE_MAX_CONTROL_RATE 64
+#endif
 class MIDIControlHandler;
 class MoniqueSynthData;
 class MoniqueSynthesizer : public Synthesiser
@@ -184,6 +209,7 @@ class MoniqueSynthesizer : public Synthesiser
     MoniqueSynthesiserVoice *const voice;
 
     int program_chnage_counter = -3;
+    int minimum_sub_block_size = MONIQUE_MIN_SUB_BLOCK_SIZE;
 
     void handleSustainPedal(int midiChannel, bool isDown) override;
     void handleSostenutoPedal(int midiChannel, bool isDown) override;
@@ -255,6 +281,25 @@ class MoniqueSynthesizer : public Synthesiser
 
     void reset_note_down_store() { note_down_store.reset(); }
 
+    // 1 RENDERS EVERY EVENT AT ITS TIMESTAMP
+    void set_minimum_sub_block_size(int num_samples_) noexcept
+    {
+        minimum_sub_block_size = jmax(1, num_samples_);
+    }
+    int get_minimum_sub_block_size() const noexcept { return minimum_sub_block_size; }
+
+    COLD void set_num_worker_threads(int num_threads_) noexcept
+    {
+        voice->set_num_worker_threads(num_threads_);
+    }
+    int get_num_worker_threads() const noexcept { return voice->get_num_worker_threads(); }
+
+    // 1 COMPUTES THE LFOS, MFOS AND ENVELOPES PER SAMPLE, N ONLY EVERY N SAMPLES AND INTERPOLATES
+    // LINEAR OR CUBIC (ENVELOPES ARE ALWAYS LINEAR)
+    void set_control_rate(int num_samples_, bool is_cubic_) noexcept;
+    int get_control_rate() const noexcept;
+    bool is_control_rate_cubic() const noexcept;
+
   private:
     NoteDownStore note_down_store;
 
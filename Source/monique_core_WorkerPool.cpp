@@ -0,0 +1,173 @@
+#include "monique_core_WorkerPool.h"
+#include "monique_core_RealtimeSanitizer.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
+//==============================================================================
+static inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static inline std::uint64_t pack_job_state(std::uint32_t generation_, int num_tasks_,
+                                           int next_task_) noexcept
+{
+    return (std::uint64_t(generation_) << 32) | (std::uint64_t(num_tasks_ & 0xffff) << 16) |
+           std::uint64_t(next_task_ & 0xffff);
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class mono_WorkerPool::Worker : public Thread
+{
+    mono_WorkerPool &pool;
+
+    void run() override
+    {
+        // THE TASKS RENDER LIKE MoniqueAudioProcessor::process, WITH FLUSH TO ZERO
+        const ScopedNoDenormals no_denormals;
+
+        std::uint32_t idle_since = Time::getMillisecondCounter();
+        int spins = 0;
+        while (not threadShouldExit())
+        {
+            if (pool.execute_tasks())
+            {
+                idle_since = Time::getMillisecondCounter();
+                spins = 0;
+            }
+            else if (++spins < 1000)
+            {
+                cpu_relax();
+            }
+            else if (Time::getMillisecondCounter() - idle_since < MONIQUE_WORKER_SPIN_MS)
+            {
+                spins = 0;
+                Thread::yield();
+            }
+            else
+            {
+                pool.park();
+                idle_since = Time::getMillisecondCounter();
+                spins = 0;
+            }
+        }
+    }
+
+  public:
+    COLD Worker(mono_WorkerPool &pool_, int id_) noexcept
+        : Thread("monique-worker-" + String(id_)), pool(pool_)
+    {
+    }
+    COLD ~Worker() noexcept { stopThread(1000); }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Worker)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// A TASK IS CLAIMED BY A COMPARE AND SWAP OF THE WHOLE STATE. THE JOB CAN NOT CHANGE UNTIL ALL
+// CLAIMED TASKS ARE DONE, SO THE TASK AND CONTEXT ARE READ AFTER THE CLAIM.
+bool mono_WorkerPool::execute_tasks() noexcept
+{
+    bool executed_a_task = false;
+    std::uint64_t state = job_state.load(std::memory_order_acquire);
+    while (int(state & 0xffff) < int((state >> 16) & 0xffff))
+    {
+        if (job_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+        {
+            MONIQUE_REALTIME_SCOPE;
+
+            job_task.load(std::memory_order_relaxed)(job_context.load(std::memory_order_relaxed),
+                                                     int(state & 0xffff));
+            num_tasks_done.fetch_add(1, std::memory_order_release);
+            executed_a_task = true;
+            state = job_state.load(std::memory_order_acquire);
+        }
+    }
+
+    return executed_a_task;
+}
+
+//==============================================================================
+// THE EVENT RESETS ITSELF FOR ONE WORKER, WHICH WAKES THE NEXT ONE
+void mono_WorkerPool::park() noexcept
+{
+    num_parked_workers.fetch_add(1, std::memory_order_acq_rel);
+    wake_up.wait();
+    if (num_parked_workers.fetch_sub(1, std::memory_order_acq_rel) > 1)
+    {
+        wake_up.signal();
+    }
+}
+
+//==============================================================================
+void mono_WorkerPool::run(task_function task_, void *context_, int num_tasks_) noexcept
+{
+    jassert(num_tasks_ <= 0xffff);
+
+    const int num_parked = num_parked_workers.load(std::memory_order_acquire);
+    if (num_parked > 0 and num_tasks_ >= 2)
+    {
+        // AN UNCONTENDED LOCK, ONLY ON THE FIRST CALLS AFTER THE WORKERS WENT IDLE
+        MONIQUE_REALTIME_EXEMPTION;
+        wake_up.signal();
+    }
+
+    if (workers.size() == num_parked or num_tasks_ < 2)
+    {
+        for (int i = 0; i < num_tasks_; ++i)
+        {
+            task_(context_, i);
+        }
+        return;
+    }
+
+    job_task.store(task_, std::memory_order_relaxed);
+    job_context.store(context_, std::memory_order_relaxed);
+    num_tasks_done.store(0, std::memory_order_relaxed);
+    job_state.store(pack_job_state(++generation, num_tasks_, 0), std::memory_order_release);
+
+    execute_tasks();
+    // ONLY TASKS THE WORKERS HAVE CLAIMED AND STILL RUN ARE LEFT
+    while (num_tasks_done.load(std::memory_order_acquire) != num_tasks_)
+    {
+        cpu_relax();
+    }
+}
+
+//==============================================================================
+COLD void mono_WorkerPool::set_num_workers(int num_workers_) noexcept
+{
+    num_workers_ = jlimit(0, jmax(0, SystemStats::getNumCpus() - 1), num_workers_);
+    while (workers.size() > num_workers_)
+    {
+        workers.getLast()->signalThreadShouldExit();
+        wake_up.signal();
+        workers.removeLast();
+    }
+    while (workers.size() < num_workers_)
+    {
+        Worker *worker = workers.add(new Worker(*this, workers.size()));
+        // THE HIGHEST PRIORITY, RUN() SPINS ON THE TASKS OF THE WORKERS
+        worker->startThread(10);
+    }
+}
+
+//==============================================================================
+COLD mono_WorkerPool::mono_WorkerPool(int num_workers_) noexcept
+    : job_state(0), job_task(nullptr), job_context(nullptr), num_tasks_done(0), generation(0),
+      num_parked_workers(0)
+{
+    set_num_workers(num_workers_);
+}
+COLD mono_WorkerPool::~mono_WorkerPool() noexcept { set_num_workers(0); }
@@ -0,0 +1,67 @@
+#ifndef MONIQUE_CORE_WORKERPOOL_H_INCLUDED
+#define MONIQUE_CORE_WORKERPOOL_H_INCLUDED
+
+#include "App.h"
+
+#include <atomic>
+#include <cstdint>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// SPINNING WORKER THREADS FOR THE AUDIO CALLBACK, RUN() DOES NOT ALLOCATE, LOCK OR WAIT FOR
+// THE SCHEDULER OF THE OS.
+//
+// THE CALLING THREAD WORKS ON THE TASKS TOO AND TAKES EVERYTHING A WORKER DOES NOT CLAIM IN TIME,
+// WITH 0 WORKERS THE TASKS SIMPLY RUN IN ORDER ON THE CALLING THREAD.
+// WORKERS SPIN FOR MONIQUE_WORKER_SPIN_MS AFTER THEIR LAST TASK AND PARK THEN ON AN EVENT. RUN()
+// ONLY POSTS TASKS IF A WORKER IS AWAKE, OTHERWISE IT WAKES THEM FOR THE NEXT CALL AND RUNS THE
+// TASKS ITSELF, SO IT NEVER WAITS FOR A PARKED WORKER TO WAKE UP.
+// A TASK A WORKER HAS CLAIMED CAN NOT BE TAKEN BACK, RUN() SPINS UNTIL IT IS DONE. IF THE OS
+// PREEMPTS THAT WORKER RUN() WAITS FOR IT, SO THE WORKERS RUN WITH THE HIGHEST THREAD PRIORITY
+// TO KEEP THIS RARE. IT IS NOT BOUNDED.
+//==============================================================================
+#ifndef MONIQUE_WORKER_SPIN_MS
+#define MONIQUE_WORKER_SPIN_MS 50
+#endif
+
+class mono_WorkerPool
+{
+  public:
+    typedef void (*task_function)(void *context_, int task_index_);
+
+  private:
+    class Worker;
+    OwnedArray<Worker> workers;
+
+    // GENERATION (32 BIT) | NUM TASKS (16 BIT) | NEXT TASK (16 BIT)
+    std::atomic<std::uint64_t> job_state;
+    std::atomic<task_function> job_task;
+    std::atomic<void *> job_context;
+    std::atomic<int> num_tasks_done;
+    std::uint32_t generation;
+
+    WaitableEvent wake_up;
+    std::atomic<int> num_parked_workers;
+
+    bool execute_tasks() noexcept;
+    void park() noexcept;
+
+  public:
+    //==========================================================================
+    // RUNS task_( context_, 0 ) ... task_( context_, num_tasks_-1 ) AND RETURNS IF ALL ARE DONE
+    void run(task_function task_, void *context_, int num_tasks_) noexcept;
+
+    int get_num_workers() const noexcept { return workers.size(); }
+    // NOT WHILE RUN() IS PROCESSING
+    COLD void set_num_workers(int num_workers_) noexcept;
+
+  public:
+    //==========================================================================
+    COLD mono_WorkerPool(int num_workers_) noexcept;
+    COLD ~mono_WorkerPool() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(mono_WorkerPool)
+};
+
+#endif // MONIQUE_CORE_WORKERPOOL_H_INCLUDED
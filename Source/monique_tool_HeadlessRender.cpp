@@ -0,0 +1,214 @@
+#include "monique_tool_Offline.h"
+
+#include "monique_core_RealtimeSanitizer.h"
+#include "monique_core_Synth.h"
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// HEADLESS OFFLINE RENDERER
+//
+// monique-render --midi <file.mid> --out <file.wav> [--program <file.mlprog>]
+//                [--sample-rate 44100] [--block-size 512] [--bpm 120] [--tail 2]
+//                [--bits 24] [--min-sub-block 32] [--workers 3] [--control-rate 1] [--cubic]
+//
+// CREATES THE PROCESSOR WITHOUT AN EDITOR, LOADS THE PROGRAM THROUGH
+// MoniqueSynthData::read_from AND FEEDS THE MIDI FILE THROUGH processBlock.
+//
+// BUILT WITH MONIQUE_RT_SANITIZER IT FAILS IF processBlock ALLOCATED OR LOCKED.
+//==============================================================================
+static bool load_midi(MidiMessageSequence &sequence_, const File &midi_file_) noexcept
+{
+    FileInputStream stream(midi_file_);
+    if (not stream.openedOk())
+    {
+        return false;
+    }
+
+    MidiFile midi_file;
+    if (not midi_file.readFrom(stream))
+    {
+        return false;
+    }
+
+    // NOTE: TIMESTAMPS ARE IN SECONDS AFTER THIS CALL
+    midi_file.convertTimestampTicksToSeconds();
+    for (int track_id = 0; track_id != midi_file.getNumTracks(); ++track_id)
+    {
+        sequence_.addSequence(*midi_file.getTrack(track_id), 0);
+    }
+    sequence_.sort();
+    sequence_.updateMatchedPairs();
+
+    return true;
+}
+
+//==============================================================================
+static int print_usage() noexcept
+{
+    std::cout << "usage: monique-render --midi <file.mid> --out <file.wav>" << std::endl
+              << "                     [--program <file.mlprog>] [--sample-rate 44100]" << std::endl
+              << "                     [--block-size 512] [--bpm 120] [--tail 2] [--bits 24]"
+              << std::endl
+              << "                     [--min-sub-block 32] [--workers 3]" << std::endl
+              << "                     [--control-rate 1] [--cubic]" << std::endl;
+    return 1;
+}
+static String get_option(const ArgumentList &args_, StringRef option_,
+                         const String &default_) noexcept
+{
+    if (args_.containsOption(option_))
+    {
+        return args_.getValueForOption(option_);
+    }
+
+    return default_;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    ArgumentList args(argc, argv);
+    if (not args.containsOption("--midi") or not args.containsOption("--out"))
+    {
+        return print_usage();
+    }
+
+    const double sample_rate = get_option(args, "--sample-rate", "44100").getDoubleValue();
+    const int block_size = get_option(args, "--block-size", "512").getIntValue();
+    const double bpm = get_option(args, "--bpm", "120").getDoubleValue();
+    const double tail_in_seconds = get_option(args, "--tail", "2").getDoubleValue();
+    const int bits = get_option(args, "--bits", "24").getIntValue();
+    const int min_sub_block_size =
+        get_option(args, "--min-sub-block", String(MONIQUE_MIN_SUB_BLOCK_SIZE)).getIntValue();
+    const int num_workers =
+        get_option(args, "--workers", String(MONIQUE_NUM_WORKER_THREADS)).getIntValue();
+    const int control_rate = get_option(args, "--control-rate", "1").getIntValue();
+    if (sample_rate <= 0 or block_size <= 0 or bpm <= 0 or tail_in_seconds < 0 or
+        min_sub_block_size < 1 or num_workers < 0 or control_rate < 1 or
+        control_rate > MONIQUE_MAX_CONTROL_RATE)
+    {
+        return print_usage();
+    }
+
+    const File midi_file(File::getCurrentWorkingDirectory().getChildFile(
+        args.getValueForOption("--midi").unquoted()));
+    const File out_file(File::getCurrentWorkingDirectory().getChildFile(
+        args.getValueForOption("--out").unquoted()));
+
+    // THE LOOK AND FEEL AND THE PARAMETER TIMERS NEED A MESSAGE MANAGER
+    ScopedJuceInitialiser_GUI juce_initialiser;
+
+    std::unique_ptr<AudioProcessor> owned_processor = create_headless_processor();
+    MoniqueAudioProcessor *processor = dynamic_cast<MoniqueAudioProcessor *>(owned_processor.get());
+    AudioProcessor &audio_processor = *owned_processor;
+
+    // LOAD THE PROGRAM, THE FACTORY DEFAULT IS ALREADY LOADED BY THE CTOR
+    if (args.containsOption("--program"))
+    {
+        const File program_file(File::getCurrentWorkingDirectory().getChildFile(
+            args.getValueForOption("--program").unquoted()));
+        if (not load_program(*processor, program_file))
+        {
+            std::cerr << "MONIQUE: can not load program " << program_file.getFullPathName()
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    MidiMessageSequence sequence;
+    if (not load_midi(sequence, midi_file))
+    {
+        std::cerr << "MONIQUE: can not read midi file " << midi_file.getFullPathName()
+                  << std::endl;
+        return 1;
+    }
+
+    // PREPARE
+    const int num_channels = jmax(2, audio_processor.getTotalNumOutputChannels());
+    OfflinePlayHead play_head(sample_rate, bpm);
+    audio_processor.setPlayHead(&play_head);
+    audio_processor.setNonRealtime(true);
+    audio_processor.setRateAndBufferSizeDetails(sample_rate, block_size);
+    audio_processor.prepareToPlay(sample_rate, block_size);
+    processor->synth->set_minimum_sub_block_size(min_sub_block_size);
+    processor->synth->set_num_worker_threads(num_workers);
+    processor->synth->set_control_rate(control_rate, args.containsOption("--cubic"));
+
+    out_file.deleteFile();
+    std::unique_ptr<FileOutputStream> out_stream(out_file.createOutputStream());
+    if (not out_stream)
+    {
+        std::cerr << "MONIQUE: can not write " << out_file.getFullPathName() << std::endl;
+        return 1;
+    }
+    WavAudioFormat wav_format;
+    std::unique_ptr<AudioFormatWriter> writer(
+        wav_format.createWriterFor(out_stream.get(), sample_rate, num_channels, bits, {}, 0));
+    if (not writer)
+    {
+        std::cerr << "MONIQUE: unsupported wav format" << std::endl;
+        return 1;
+    }
+    out_stream.release(); // OWNED BY THE WRITER NOW
+
+    // RENDER
+    const double length_in_seconds = sequence.getEndTime() + tail_in_seconds;
+    const int64 length_in_samples = int64(std::ceil(length_in_seconds * sample_rate));
+
+    AudioSampleBuffer buffer(num_channels, block_size);
+    MidiBuffer midi_messages;
+    int event_index = 0;
+    const int num_events = sequence.getNumEvents();
+    const int64 start_time = Time::getHighResolutionTicks();
+    for (int64 block_start = 0; block_start < length_in_samples; block_start += block_size)
+    {
+        const int64 block_end = block_start + block_size;
+
+        midi_messages.clear();
+        while (event_index < num_events)
+        {
+            const MidiMessage &message = sequence.getEventPointer(event_index)->message;
+            const int64 event_sample = int64(message.getTimeStamp() * sample_rate);
+            if (event_sample >= block_end)
+            {
+                break;
+            }
+
+            if (not message.isMetaEvent())
+            {
+                midi_messages.addEvent(message, int(jmax(int64(0), event_sample - block_start)));
+            }
+            ++event_index;
+        }
+
+        audio_processor.processBlock(buffer, midi_messages);
+        play_head.advance(block_size);
+
+        const int samples_to_write = int(jmin(int64(block_size), length_in_samples - block_start));
+        writer->writeFromAudioSampleBuffer(buffer, 0, samples_to_write);
+    }
+    const double render_time_in_seconds =
+        Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start_time);
+
+    audio_processor.releaseResources();
+    audio_processor.setPlayHead(nullptr);
+    writer = nullptr;
+
+    std::cout << "MONIQUE: rendered " << length_in_seconds << "s at " << sample_rate << "Hz / "
+              << block_size << " samples per block in " << render_time_in_seconds << "s to "
+              << out_file.getFullPathName() << std::endl;
+
+#if MONIQUE_RT_SANITIZER
+    const int num_violations = get_num_realtime_violations();
+    std::cout << "MONIQUE: " << num_violations << " real time violations" << std::endl;
+    if (num_violations > 0)
+    {
+        return 1;
+    }
+#endif
+
+    return 0;
+}
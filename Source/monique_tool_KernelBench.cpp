@@ -0,0 +1,1424 @@
+// NOTE: THE DSP KERNELS ARE DEFINED INSIDE THE SYNTH TRANSLATION UNIT, SO WE INCLUDE IT HERE AND
+// THE BENCHMARK TARGET DOES NOT COMPILE monique_core_Synth.cpp ON ITS OWN
+#include "monique_core_Synth.cpp"
+
+#include "monique_core_RealtimeSanitizer.h"
+#include "monique_tool_Offline.h"
+
+#include <atomic>
+#include <thread>
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// DSP KERNEL MICRO BENCHMARK
+//
+// monique-kernel-bench [--seconds 2] [--repeats 5] [--kernel <name>] [--csv]
+// monique-kernel-bench --check
+//
+// RUNS EVERY KERNEL FOR EACH SAMPLE RATE AND BLOCK SIZE AND REPORTS THE BEST OF <repeats>
+// MEASUREMENTS IN NANOSECONDS PER SAMPLE.
+//
+// --check ONLY SWEEPS THE APPROXIMATED SHAPERS AGAINST THE std::atan VERSIONS THEY REPLACE, RUNS
+// THE SIMD FILTER BANKS (FILTER INPUTS AND EQ BANDS) AGAINST THE SCALAR FILTERS, THE REVERB AGAINST
+// ITS SCALAR VERSION, THE BLOCK SMOOTHERS AGAINST tick(), THE FEEDBACK KERNELS FOR DENORMAL STALLS
+// IN A LONG SILENCE TAIL, THE PARAMETER SNAPSHOT FOR TORN READS, THE PARAMETER RAMPS FOR THEIR
+// TARGETS, THE SYNC MORPH FOR THE SAME VALUES WITH ANY BLOCK SIZE AND EXITS WITH 1 IF ONE OF THEM
+// IS OUT OF ITS ERROR BOUND.
+//
+// THE PARAMETER RAMPS OF THE UI RUN ONCE, IN NANOSECONDS PER STARTED RAMP AND PER RAMP AND TICK.
+//
+// LIKE MoniqueAudioProcessor::process ALL KERNELS RUN WITH FLUSH TO ZERO.
+//==============================================================================
+static const double bench_sample_rates[] = {44100, 48000, 88200, 96000, 176400, 192000};
+static const int bench_block_sizes[] = {16, 32, 64, 128, 256, 512, 1024, 2048};
+
+#define BENCH_FREQUENCY 220.0
+#define FILTER_BANK_MAX_ERROR 1.0e-5
+// THE COMBS ARE SUMMED IN ANOTHER ORDER
+#define REVERB_MAX_ERROR 1.0e-6
+// tick() SUMS THE STEPS UP, THE BLOCK RAMP MULTIPLIES THEM
+#define SMOOTHER_MAX_ERROR 1.0e-3
+// DENORMAL STALLS COST 10 TO 100 TIMES MORE, THE TAIL IS USUALLY CHEAPER THAN THE NOISE
+#define SILENCE_TAIL_MAX_SLOWDOWN 2.0
+#define SILENCE_TAIL_SECONDS 15
+#define SNAPSHOT_CHECK_SIZE 1024
+#define SNAPSHOT_CHECK_VALUES 3
+#define SNAPSHOT_CHECK_SECONDS 1
+// RANDOMIZE, MORPH TO AND BACK TO DEFAULT START HUNDREDS OF RAMPS AT ONCE
+#define PARAM_RAMPS_BENCH_SIZE 500
+#define PARAM_RAMPS_BENCH_TIME_IN_MS 1000
+// A SAMPLE BOTH BLOCK SIZES END A BLOCK ON, HALF WAY THROUGH THE SYNC MORPH AT 44.1KHZ
+#define SYNC_MORPH_CHECK_BLOCK_SIZE_1 64
+#define SYNC_MORPH_CHECK_BLOCK_SIZE_2 100
+#define SYNC_MORPH_CHECK_HALF_TIME 22400
+
+//==============================================================================
+// KEEPS THE COMPILER FROM REMOVING THE KERNEL OUTPUT
+static volatile float bench_sink = 0;
+
+struct BenchConfig
+{
+    double seconds_to_run;
+    int repeats;
+};
+
+//==============================================================================
+template <class process_block_type>
+static double measure_ns_per_sample(const BenchConfig &config_, double sample_rate_,
+                                    int block_size_, process_block_type &&process_block_) noexcept
+{
+    const int64 num_blocks =
+        jmax(int64(1), int64(config_.seconds_to_run * sample_rate_ / block_size_));
+
+    // WARM UP
+    for (int64 i = 0; i != jmin(int64(16), num_blocks); ++i)
+    {
+        process_block_();
+    }
+
+    double best = std::numeric_limits<double>::max();
+    for (int repeat = 0; repeat != config_.repeats; ++repeat)
+    {
+        const int64 start = Time::getHighResolutionTicks();
+        for (int64 i = 0; i != num_blocks; ++i)
+        {
+            process_block_();
+        }
+        const double seconds =
+            Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+        best = jmin(best, seconds * 1.0e9 / double(num_blocks * block_size_));
+    }
+
+    return best;
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// SHAPER ACCURACY
+static float reference_soft_clipping(float x_) noexcept
+{
+    return (std::atan(x_) * (1.0f / float_Pi)) * 1.5;
+}
+static float reference_soft_clipp_greater_1_2(float x_) noexcept
+{
+    if (x_ > 1)
+    {
+        x_ = 1.0f + reference_soft_clipping(x_ - 1.0f);
+    }
+    else if (x_ < -1)
+    {
+        x_ = -1.0f + reference_soft_clipping(x_ + 1.0f);
+    }
+
+    return jlimit(-1.2f, 1.2f, x_);
+}
+
+// A DENSE SWEEP OVER [-range_, range_] AND A SPARSE ONE UP TO +-1e7
+template <class reference_type, class approximation_type>
+static bool check_accuracy(const char *name_, float range_, double max_error_,
+                           reference_type &&reference_,
+                           approximation_type &&approximation_) noexcept
+{
+    // A LATER FINITE ERROR WOULD HIDE A NAN IN max_error
+    bool has_nan = false;
+    double max_error = 0;
+    float worst_input = 0;
+    auto check = [&](float x_) {
+        const double error = std::fabs(double(approximation_(x_)) - double(reference_(x_)));
+        has_nan |= std::isnan(error);
+        if (error > max_error)
+        {
+            max_error = error;
+            worst_input = x_;
+        }
+    };
+
+    const int steps = 1 << 21;
+    for (int i = 0; i <= steps; ++i)
+    {
+        check(-range_ + 2 * range_ * float(i) / steps);
+    }
+    for (float x = range_; x < 1.0e7f; x *= 1.01f)
+    {
+        check(x);
+        check(-x);
+    }
+
+    const bool passed = not has_nan and max_error <= max_error_;
+    std::cout << String(name_).paddedRight(' ', 36) << " max error "
+              << (has_nan ? String("nan") : String(max_error, 9))
+              << " at " << String(worst_input, 5).paddedRight(' ', 14) << " bound "
+              << String(max_error_, 9) << (passed ? "   ok" : "   FAILED") << std::endl;
+
+    return passed;
+}
+static bool check_shapers() noexcept
+{
+    const double soft_clipping_bound = FAST_ATAN_MAX_ERROR * 1.5 / double_Pi;
+
+    bool passed = true;
+    passed &= check_accuracy(
+        "fast_atan", 20, FAST_ATAN_MAX_ERROR, [](float x_) { return std::atan(x_); },
+        [](float x_) { return fast_atan(x_); });
+    passed &= check_accuracy(
+        "fast_atan (simd)", 20, FAST_ATAN_MAX_ERROR, [](float x_) { return std::atan(x_); },
+        [](float x_) { return fast_atan(mono_float4::broadcast(x_)).get(0); });
+    passed &= check_accuracy(
+        "soft_clipping", 20, soft_clipping_bound, reference_soft_clipping,
+        [](float x_) { return soft_clipping(x_); });
+    passed &= check_accuracy(
+        "soft_clipping (simd)", 20, soft_clipping_bound, reference_soft_clipping,
+        [](float x_) { return soft_clipping(mono_float4::broadcast(x_)).get(0); });
+    passed &= check_accuracy(
+        "soft_clipp_greater_1_2", 20, soft_clipping_bound, reference_soft_clipp_greater_1_2,
+        [](float x_) { return soft_clipp_greater_1_2(x_); });
+    passed &= check_accuracy(
+        "soft_clipp_greater_1_2 (simd)", 20, soft_clipping_bound,
+        reference_soft_clipp_greater_1_2,
+        [](float x_) { return soft_clipp_greater_1_2(mono_float4::broadcast(x_)).get(0); });
+
+    // THE INLINE SHAPERS OF THE LFO (FASTEST SPEED), THE FILTER DISTORTION AND THE EQ
+    passed &= check_accuracy(
+        "LFO wave shaper", 1, FAST_ATAN_MAX_ERROR / 1.55,
+        [](float x_) { return std::atan(x_ * 250 * 16) * (1.0f / 1.55); },
+        [](float x_) { return fast_atan(x_ * 250 * 16) * (1.0f / 1.55); });
+    passed &= check_accuracy(
+        "FilterProcessor::distortion__", 2, FAST_ATAN_MAX_ERROR / 6.66,
+        [](float x_) { return std::atan(x_ * 20) / 6.66; },
+        [](float x_) { return fast_atan(x_ * 20) / 6.66f; });
+    passed &= check_accuracy(
+        "EQ distortion", 2, FAST_ATAN_MAX_ERROR * 0.7,
+        [](float x_) { return std::atan(x_ * 10) * 0.7f; },
+        [](float x_) { return fast_atan(x_ * 10) * 0.7f; });
+
+    return passed;
+}
+
+//==============================================================================
+// A WRITER THREAD FILLS THE SOURCE AND THE SINGLE VALUES WITH A NEW VALUE PER WRITE SCOPE, EVERY
+// SNAPSHOT THE READER TAKES MUST HOLD ONE VALUE ONLY
+static bool check_parameter_snapshot() noexcept
+{
+    mono_ParameterSnapshot snapshot;
+    HeapBlock<float> source(SNAPSHOT_CHECK_SIZE, true);
+    float single_values[SNAPSHOT_CHECK_VALUES] = {};
+    int single_value_offsets[SNAPSHOT_CHECK_VALUES];
+    single_value_offsets[0] = snapshot.add_value(&single_values[0]);
+    const int offset = snapshot.add_region(source, SNAPSHOT_CHECK_SIZE);
+    for (int i = 1; i != SNAPSHOT_CHECK_VALUES; ++i)
+    {
+        single_value_offsets[i] = snapshot.add_value(&single_values[i]);
+    }
+
+    std::atomic<bool> stop(false);
+    std::thread writer([&]() {
+        for (float value = 1; not stop.load(std::memory_order_relaxed); ++value)
+        {
+            {
+                const mono_VersionGuard::ScopedWrite write(snapshot.guard);
+                for (int i = 0; i != SNAPSHOT_CHECK_SIZE; ++i)
+                {
+                    source[i] = value;
+                }
+                for (int i = 0; i != SNAPSHOT_CHECK_VALUES; ++i)
+                {
+                    single_values[i] = value;
+                }
+            }
+
+            // LEAVE THE READER SOME ROOM BETWEEN THE SCOPES
+            for (int i = 0; i != SNAPSHOT_CHECK_SIZE; ++i)
+            {
+                bench_sink = source[i];
+            }
+        }
+    });
+
+    int num_snapshots = 0;
+    int num_torn = 0;
+    const double end_ms = Time::getMillisecondCounterHiRes() + SNAPSHOT_CHECK_SECONDS * 1000;
+    while (Time::getMillisecondCounterHiRes() < end_ms)
+    {
+        if (snapshot.update())
+        {
+            ++num_snapshots;
+            const float *const values = snapshot.get() + offset;
+            bool is_torn = false;
+            for (int i = 1; i != SNAPSHOT_CHECK_SIZE; ++i)
+            {
+                is_torn |= values[i] != values[0];
+            }
+            for (int i = 0; i != SNAPSHOT_CHECK_VALUES; ++i)
+            {
+                is_torn |= snapshot.get()[single_value_offsets[i]] != values[0];
+            }
+            num_torn += is_torn;
+        }
+    }
+    stop = true;
+    writer.join();
+
+    const bool passed = num_torn == 0 and num_snapshots > 0;
+    std::cout << String("mono_ParameterSnapshot").paddedRight(' ', 36) << " snapshots "
+              << num_snapshots << " torn " << num_torn << (passed ? "   ok" : "   FAILED")
+              << std::endl;
+
+    return passed;
+}
+
+//==============================================================================
+// mono_Reverb BEFORE THE COMB FILTER BANK: EIGHT SCALAR COMBS AND FOUR ALL PASSES WITH % WRAPPED
+// BUFFERS OF THE EXACT DELAY SIZE
+class ReferenceReverb
+{
+    Array<float> combs[8];
+    int comb_indexes[8];
+    Array<float> all_passes[4];
+    int all_pass_indexes[4];
+
+    static float tick(Array<float> &buffer_, int &index_, float input_, float feedback_) noexcept
+    {
+        const float last = buffer_.getUnchecked(index_);
+        float temp = input_ + last * feedback_;
+#if !MONIQUE_NO_UNDENORMALISE
+        JUCE_UNDENORMALISE(temp);
+#endif
+        buffer_.setUnchecked(index_, temp);
+        index_ = (index_ + 1) % buffer_.size();
+
+        return last;
+    }
+
+  public:
+    float process(float in_, float feedback_, float wet_gain_1_, float wet_gain_2_,
+                  float dry_level_) noexcept
+    {
+        float out = 0;
+        for (int i = 0; i != 8; ++i)
+        {
+            out += tick(combs[i], comb_indexes[i], in_ * REVERB_GAIN, feedback_);
+        }
+        for (int i = 0; i != 4; ++i)
+        {
+            out = tick(all_passes[i], all_pass_indexes[i], out, 0.5f) - out;
+        }
+
+        return out * wet_gain_1_ + out * wet_gain_2_ + in_ * dry_level_;
+    }
+
+    ReferenceReverb(int sample_rate_, bool left_or_right_) noexcept
+    {
+        static const int comb_tunings[] = {1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617};
+        static const int all_pass_tunings[] = {556, 441, 341, 225};
+        const int spread = left_or_right_ == LEFT ? 0 : 23;
+        for (int i = 0; i != 8; ++i)
+        {
+            combs[i].insertMultiple(0, 0, sample_rate_ * (comb_tunings[i] + spread) / 44100);
+            comb_indexes[i] = 0;
+        }
+        for (int i = 0; i != 4; ++i)
+        {
+            all_passes[i].insertMultiple(0, 0,
+                                         sample_rate_ * (all_pass_tunings[i] + spread) / 44100);
+            all_pass_indexes[i] = 0;
+        }
+    }
+};
+
+//==============================================================================
+// WORKS FOR DoubleAnalogFilter AND DoubleAnalogFilterBank
+template <class filter_type, class sample_type>
+static sample_type update_and_process(filter_type &filter_, FILTER_TYPS type_, float resonance_,
+                                      float cutoff_, sample_type io_) noexcept
+{
+    switch (type_)
+    {
+    case LPF_2_PASS:
+        filter_.updateLow2Pass(resonance_, cutoff_);
+        return filter_.processLow2Pass(io_);
+    case HIGH_2_PASS:
+        filter_.updateHigh2Pass(resonance_, cutoff_);
+        return filter_.processHigh2Pass(io_);
+    case BPF:
+        filter_.updateBand(resonance_, cutoff_);
+        return filter_.processBand(io_);
+    default:
+        return filter_.processPass(io_);
+    }
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+class KernelBench
+{
+    AudioProcessor &audio_processor;
+    MoniqueSynthData *const synth_data;
+    RuntimeNotifyer *const notifyer;
+
+    const BenchConfig config;
+    const String only_kernel;
+    const bool as_csv;
+
+    double sample_rate;
+    int block_size;
+
+    mono_AudioSampleBuffer<2> input;
+    mono_AudioSampleBuffer<2> output;
+    mono_AudioSampleBuffer<3> controls;
+
+    //==========================================================================
+    void prepare(double sample_rate_, int block_size_) noexcept
+    {
+        sample_rate = sample_rate_;
+        block_size = block_size_;
+
+        audio_processor.setRateAndBufferSizeDetails(sample_rate_, block_size_);
+        audio_processor.prepareToPlay(sample_rate_, block_size_);
+
+        input.setSize(block_size_, false);
+        output.setSize(block_size_, false);
+        controls.setSize(block_size_, false);
+
+        // A FULL SCALE SAW AS INPUT FOR THE FILTERS AND EFFECTS
+        Random random(1234);
+        for (int channel = 0; channel != 2; ++channel)
+        {
+            float *const data = input.getWritePointer(channel);
+            for (int sid = 0; sid != block_size_; ++sid)
+            {
+                data[sid] = (random.nextFloat() * 2 - 1) * 0.1f +
+                            float(fmod(sid * BENCH_FREQUENCY / sample_rate_, 1.0) * 2 - 1) * 0.9f;
+            }
+        }
+        FloatVectorOperations::fill(controls.getWritePointer(0), 0.5f, block_size_);
+        FloatVectorOperations::fill(controls.getWritePointer(1), 0.5f, block_size_);
+        FloatVectorOperations::fill(controls.getWritePointer(2), 1.0f, block_size_);
+
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            FloatVectorOperations::fill(
+                synth_data->data_buffer->band_env_buffers.getWritePointer(band_id), 1.0f,
+                block_size_);
+        }
+    }
+
+    //==========================================================================
+    template <class process_block_type>
+    void run(const char *name_, process_block_type &&process_block_) noexcept
+    {
+        if (only_kernel.isNotEmpty() and not String(name_).containsIgnoreCase(only_kernel))
+        {
+            return;
+        }
+
+        const double ns_per_sample =
+            measure_ns_per_sample(config, sample_rate, block_size, process_block_);
+        const double ns_budget_per_sample = 1.0e9 / sample_rate;
+        if (as_csv)
+        {
+            std::cout << name_ << "," << sample_rate << "," << block_size << "," << ns_per_sample
+                      << std::endl;
+        }
+        else
+        {
+            const double percent_of_budget = 100.0 * ns_per_sample / ns_budget_per_sample;
+            std::cout << String(name_).paddedRight(' ', 36)
+                      << String(sample_rate, 0).paddedLeft(' ', 8)
+                      << String(block_size).paddedLeft(' ', 7)
+                      << String(ns_per_sample, 2).paddedLeft(' ', 12) << " ns/sample"
+                      << String(percent_of_budget, 3).paddedLeft(' ', 10) << " % of budget"
+                      << std::endl;
+        }
+    }
+
+    //==========================================================================
+    // SAWS TICK WITH THE PHASE, SQUARES WITH THE ANGLE OF THE CYCLE COUNTER
+    template <class Generator> void run_generator(const char *name_, bool tick_angle_) noexcept
+    {
+        float *const out = output.getWritePointer(LEFT);
+
+        PerfectCycleCounter cycle_counter(notifyer);
+        cycle_counter.set_frequency(BENCH_FREQUENCY);
+        Generator generator;
+        generator.updateHarmonics(cycle_counter.get_cylces_per_sec());
+        run(name_, [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                cycle_counter.tick();
+                out[sid] = generator.tick(tick_angle_ ? cycle_counter.get_last_angle()
+                                                      : cycle_counter.get_last_phase());
+            }
+            bench_sink = out[block_size - 1];
+        });
+    }
+    void run_oscillators() noexcept
+    {
+        float *const out = output.getWritePointer(LEFT);
+
+        run_generator<mono_BlitSaw>("mono_BlitSaw", false);
+        run_generator<mono_BlitSquare>("mono_BlitSquare", true);
+        run_generator<mono_PolyBLEPSaw>("mono_PolyBLEPSaw", false);
+        run_generator<mono_PolyBLEPSquare>("mono_PolyBLEPSquare", true);
+        {
+            PerfectCycleCounter cycle_counter(notifyer);
+            cycle_counter.set_frequency(BENCH_FREQUENCY);
+            mono_SineWave sine(synth_data->sine_lookup);
+            run("mono_SineWave", [&]() {
+                for (int sid = 0; sid != block_size; ++sid)
+                {
+                    cycle_counter.tick();
+                    out[sid] = sine.tick(cycle_counter.get_last_angle());
+                }
+                bench_sink = out[block_size - 1];
+            });
+        }
+        {
+            float *const angles = output.getWritePointer(RIGHT);
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                angles[sid] = sid * float(BENCH_FREQUENCY / sample_rate * double_Pi_2);
+            }
+            run("lookup (block)", [&]() {
+                lookup(synth_data->sine_lookup, angles, out, block_size);
+                bench_sink = out[block_size - 1];
+            });
+        }
+    }
+    void run_envelopes() noexcept
+    {
+        float *const out = output.getWritePointer(LEFT);
+
+        mono_ENVOsccilator env(notifyer, synth_data->sine_lookup, synth_data->cos_lookup,
+                               synth_data->exp_lookup);
+        bool attack = true;
+        run("mono_ENVOsccilator", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                if (env.is_finished())
+                {
+                    // ALTERNATE ATTACK AND RELEASE STAGES OF 100MS
+                    env.set_process_values(env.last_out(), attack ? 1 : 0, 0.3f,
+                                           msToSamplesFast(100, sample_rate));
+                    if (attack)
+                    {
+                        env.calculate_attack_coeffecients();
+                    }
+                    else
+                    {
+                        env.calculate_release_coeffecients();
+                    }
+                    attack = not attack;
+                }
+                out[sid] = env.tick();
+            }
+            bench_sink = out[block_size - 1];
+        });
+    }
+    void run_filters() noexcept
+    {
+        const float *const in = input.getReadPointer(LEFT);
+        float *const out = output.getWritePointer(LEFT);
+
+        AnalogFilter filter(notifyer);
+        float cutoff = 1000;
+        const auto modulate_cutoff = [&]() {
+            // A SLOW SWEEP, THE COEFFICIENTS ARE UPDATED EVERY SAMPLE LIKE IN THE FILTER PROCESSOR
+            cutoff = cutoff > 8000 ? 200 : cutoff * 1.0001f;
+            filter.update(0.7f, cutoff);
+            filter.calc_coefficients(cutoff);
+        };
+
+        run("AnalogFilter::processLow", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                modulate_cutoff();
+                out[sid] = filter.processLow(in[sid]);
+            }
+            bench_sink = out[block_size - 1];
+        });
+        filter.reset();
+        run("AnalogFilter::processLowResonance", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                modulate_cutoff();
+                out[sid] = filter.processLowResonance(in[sid]);
+            }
+            bench_sink = out[block_size - 1];
+        });
+        filter.reset();
+        run("AnalogFilter::processHighResonance", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                modulate_cutoff();
+                out[sid] = filter.processHighResonance(in[sid]);
+            }
+            bench_sink = out[block_size - 1];
+        });
+
+        // THE INPUTS OF ONE FilterProcessor
+        {
+            OwnedArray<DoubleAnalogFilter> filters;
+            for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+            {
+                filters.add(new DoubleAnalogFilter(notifyer));
+                filters[input_id]->update_filter_to(LPF_2_PASS);
+            }
+            float cutoff_slider = 0;
+            run("DoubleAnalogFilter (3 inputs)", [&]() {
+                for (int sid = 0; sid != block_size; ++sid)
+                {
+                    cutoff_slider = cutoff_slider > 1 ? 0 : cutoff_slider + 0.0001f;
+                    for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+                    {
+                        DoubleAnalogFilter &double_filter = *filters.getUnchecked(input_id);
+                        double_filter.updateLow2Pass(0.7f, cutoff_slider);
+                        out[sid] = double_filter.processLow2Pass(in[sid]);
+                    }
+                }
+                bench_sink = out[block_size - 1];
+            });
+        }
+        {
+            DoubleAnalogFilterBank filter_bank(notifyer);
+            filter_bank.update_filter_to(LPF_2_PASS);
+            float cutoff_slider = 0;
+            run("DoubleAnalogFilterBank (3 inputs)", [&]() {
+                for (int sid = 0; sid != block_size; ++sid)
+                {
+                    cutoff_slider = cutoff_slider > 1 ? 0 : cutoff_slider + 0.0001f;
+                    filter_bank.updateLow2Pass(0.7f, cutoff_slider);
+                    out[sid] = filter_bank.processLow2Pass(mono_float4::broadcast(in[sid])).get(0);
+                }
+                bench_sink = out[block_size - 1];
+            });
+        }
+    }
+    void run_eq() noexcept
+    {
+        float *const io = output.getWritePointer(LEFT);
+
+        EQProcessor eq(notifyer, synth_data);
+        run("EQProcessor", [&]() {
+            FloatVectorOperations::copy(io, input.getReadPointer(LEFT), block_size);
+            eq.process(io, block_size);
+            bench_sink = io[block_size - 1];
+        });
+    }
+    void run_effects() noexcept
+    {
+        float *const out_l = output.getWritePointer(LEFT);
+        float *const out_r = output.getWritePointer(RIGHT);
+        float *const in_l = input.getWritePointer(LEFT);
+        float *const in_r = input.getWritePointer(RIGHT);
+
+        {
+            mono_Chorus chorus(notifyer, synth_data);
+            run("mono_Chorus", [&]() {
+                chorus.process(in_l, in_r, out_l, out_r, block_size);
+                bench_sink = out_l[block_size - 1];
+            });
+        }
+        {
+            mono_Delay delay(notifyer, synth_data);
+            delay.set_reflexion_size(10, 17, 200, 120);
+            const float *const power = controls.getReadPointer(0);
+            const float *const pan = controls.getReadPointer(1);
+            const float *const release = controls.getReadPointer(2);
+            run("mono_Delay", [&]() {
+                FloatVectorOperations::copy(out_l, in_l, block_size);
+                FloatVectorOperations::copy(out_r, in_r, block_size);
+                delay.process(out_l, out_r, power, pan, release, false, block_size);
+                bench_sink = out_l[block_size - 1];
+            });
+        }
+        {
+            mono_Reverb reverb(notifyer, LEFT);
+            ReverbParameters &parameters = reverb.get_parameters();
+            parameters.roomSize = 0.7f;
+            parameters.dryLevel = 0.5f;
+            parameters.wetLevel = 0.5f;
+            parameters.width = 0.5f;
+            reverb.update_parameters();
+            run("mono_Reverb", [&]() {
+                for (int sid = 0; sid != block_size; ++sid)
+                {
+                    out_l[sid] = reverb.processSingleSampleRaw(in_l[sid]);
+                }
+                bench_sink = out_l[block_size - 1];
+            });
+        }
+    }
+    void run_modulators() noexcept
+    {
+        float *const out = output.getWritePointer(LEFT);
+
+        LFO lfo(notifyer, synth_data, synth_data->lfo_datas[0], synth_data->sine_lookup);
+        RuntimeInfo *const runtime_info = synth_data->runtime_info;
+        runtime_info->relative_samples_since_start = 0;
+        run("LFO::process", [&]() {
+            lfo.process(out, -1, 0, 0, block_size);
+            runtime_info->relative_samples_since_start += block_size;
+            bench_sink = out[block_size - 1];
+        });
+
+        // CONTROL RATE, ONE SINE EVERY 16 SAMPLES
+        synth_data->control_rate = 16;
+        run("LFO::process (control rate 16, linear)", [&]() {
+            lfo.process(out, -1, 0, 0, block_size);
+            runtime_info->relative_samples_since_start += block_size;
+            bench_sink = out[block_size - 1];
+        });
+        synth_data->control_rate_is_cubic = true;
+        run("LFO::process (control rate 16, cubic)", [&]() {
+            lfo.process(out, -1, 0, 0, block_size);
+            runtime_info->relative_samples_since_start += block_size;
+            bench_sink = out[block_size - 1];
+        });
+        synth_data->control_rate = 1;
+        synth_data->control_rate_is_cubic = false;
+    }
+    void run_smoothers() noexcept
+    {
+        float *const out = output.getWritePointer(LEFT);
+
+        // A NEW TARGET EVERY 100MS, LIKE A TURNED KNOB
+        LinearSmoother smoother;
+        int samples_to_next_target = 0;
+        float next_target = 1;
+        const auto update_target = [&]() {
+            smoother.reset_coefficients(sample_rate, 50);
+            samples_to_next_target -= block_size;
+            if (samples_to_next_target <= 0)
+            {
+                smoother.set_value(next_target);
+                next_target = 1 - next_target;
+                samples_to_next_target = msToSamplesFast(100, sample_rate);
+            }
+        };
+
+        run("LinearSmoother::tick", [&]() {
+            update_target();
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                out[sid] = smoother.tick();
+            }
+            bench_sink = out[block_size - 1];
+        });
+        run("LinearSmoother::process (block)", [&]() {
+            update_target();
+            smoother.process(out, block_size);
+            bench_sink = out[block_size - 1];
+        });
+    }
+
+    void run_param_ramps() noexcept
+    {
+        const String name = "ChangeParamOverTime (" + String(PARAM_RAMPS_BENCH_SIZE) + " ramps)";
+        if (only_kernel.isNotEmpty() and not name.containsIgnoreCase(only_kernel))
+        {
+            return;
+        }
+
+        OwnedArray<Parameter> params;
+        for (int i = 0; i != PARAM_RAMPS_BENCH_SIZE; ++i)
+        {
+            params.add(new Parameter(0, 1, 0, 1000, "ramp " + String(i), "ramp " + String(i)));
+        }
+
+        ChangeParamOverTime &scheduler = synth_data->param_change_scheduler.get();
+        double ns_per_start = std::numeric_limits<double>::max();
+        double ns_per_step = std::numeric_limits<double>::max();
+        for (int repeat = 0; repeat != config.repeats; ++repeat)
+        {
+            int64 start = Time::getHighResolutionTicks();
+            for (Parameter *param : params)
+            {
+                ChangeParamOverTime::execute(*param, 1.0f - param->get_value(),
+                                             PARAM_RAMPS_BENCH_TIME_IN_MS);
+            }
+            const double start_seconds =
+                Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+
+            int64 num_steps = 0;
+            start = Time::getHighResolutionTicks();
+            while (scheduler.get_num_ramps() > 0)
+            {
+                num_steps += scheduler.get_num_ramps();
+                scheduler.advance();
+            }
+            const double step_seconds =
+                Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+
+            ns_per_start = jmin(ns_per_start, start_seconds * 1.0e9 / PARAM_RAMPS_BENCH_SIZE);
+            ns_per_step = jmin(ns_per_step, step_seconds * 1.0e9 / double(num_steps));
+        }
+        bench_sink = params.getLast()->get_value();
+
+        if (as_csv)
+        {
+            std::cout << name << ",,," << ns_per_step << std::endl;
+        }
+        else
+        {
+            std::cout << name.paddedRight(' ', 36) << String(ns_per_start, 2).paddedLeft(' ', 12)
+                      << " ns/start" << String(ns_per_step, 2).paddedLeft(' ', 12)
+                      << " ns/ramp and tick" << std::endl;
+        }
+    }
+
+    void run_shapers() noexcept
+    {
+        const float *const in = input.getReadPointer(LEFT);
+        float *const out = output.getWritePointer(LEFT);
+
+        run("std::atan", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                out[sid] = std::atan(in[sid] * 10);
+            }
+            bench_sink = out[block_size - 1];
+        });
+        run("fast_atan", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                out[sid] = fast_atan(in[sid] * 10);
+            }
+            bench_sink = out[block_size - 1];
+        });
+        run("fast_atan (block)", [&]() {
+            fast_atan(in, out, block_size);
+            bench_sink = out[block_size - 1];
+        });
+        run("soft_clipp_greater_1_2", [&]() {
+            for (int sid = 0; sid != block_size; ++sid)
+            {
+                out[sid] = soft_clipp_greater_1_2(in[sid] * 2);
+            }
+            bench_sink = out[block_size - 1];
+        });
+        run("soft_clipp_greater_1_2 (simd)", [&]() {
+            int sid = 0;
+            for (; sid <= block_size - MONO_SIMD_LANES; sid += MONO_SIMD_LANES)
+            {
+                soft_clipp_greater_1_2(mono_float4::load(in + sid) * 2).store(out + sid);
+            }
+            for (; sid < block_size; ++sid)
+            {
+                out[sid] = soft_clipp_greater_1_2(in[sid] * 2);
+            }
+            bench_sink = out[block_size - 1];
+        });
+    }
+
+  public:
+    //==========================================================================
+    // THE FILTER BANK AGAINST ONE SCALAR DoubleAnalogFilter PER LANE: FILTER TYPE CHANGES (WITH
+    // THEIR CROSSFADES), A CUTOFF AND RESONANCE SWEEP AND LANES THAT FALL SILENT
+    bool check_filter_bank() noexcept
+    {
+        prepare(44100, 512);
+
+        OwnedArray<DoubleAnalogFilter> filters;
+        for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+        {
+            filters.add(new DoubleAnalogFilter(notifyer));
+        }
+        DoubleAnalogFilterBank filter_bank(notifyer);
+
+        static const FILTER_TYPS types[] = {LPF_2_PASS, HIGH_2_PASS, BPF, PASS, LPF_2_PASS};
+        Random random(1234);
+        bool has_nan = false;
+        double max_error = 0;
+        for (FILTER_TYPS type : types)
+        {
+            filter_bank.update_filter_to(type);
+            for (DoubleAnalogFilter *double_filter : filters)
+            {
+                double_filter->update_filter_to(type);
+            }
+
+            for (int sid = 0; sid != 20000; ++sid)
+            {
+                const float resonance = 0.3f + 0.6f * float(sid % 7000) / 7000;
+                const float cutoff_slider = float(sid % 5000) / 5000;
+
+                // EVERY OTHER 3000 SAMPLES ONLY LANE 0 HAS AN INPUT
+                float lanes[MONO_SIMD_LANES] = {0};
+                for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+                {
+                    if (input_id == 0 or sid / 3000 % 2 == 0)
+                    {
+                        lanes[input_id] = (random.nextFloat() - 0.5f) * (input_id + 1);
+                    }
+                }
+
+                const mono_float4 result = update_and_process(
+                    filter_bank, type, resonance, cutoff_slider, mono_float4::load(lanes));
+                for (int input_id = 0; input_id != SUM_INPUTS_PER_FILTER; ++input_id)
+                {
+                    const float expected =
+                        update_and_process(*filters.getUnchecked(input_id), type, resonance,
+                                           cutoff_slider, lanes[input_id]);
+                    const double error = std::fabs(double(result.get(input_id)) - expected);
+                    has_nan |= std::isnan(error);
+                    if (error > max_error)
+                    {
+                        max_error = error;
+                    }
+                }
+            }
+        }
+
+        const bool passed = not has_nan and max_error <= FILTER_BANK_MAX_ERROR;
+        std::cout << String("DoubleAnalogFilterBank").paddedRight(' ', 36) << " max error "
+                  << (has_nan ? String("nan") : String(max_error, 9)) << " bound "
+                  << String(FILTER_BANK_MAX_ERROR, 9)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+    // THE EQ BANDS AS LANES AGAINST ONE AnalogFilter AND IIRFilter PER BAND, WITH A SHAPE SWEEP
+    // AND BANDS THAT FALL SILENT
+    bool check_eq_bands() noexcept
+    {
+        prepare(44100, 512);
+
+        OwnedArray<AnalogFilter> filters;
+        IIRFilter high_pass_filters[SUM_EQ_BANDS];
+        float cutoffs[SUM_EQ_LANES];
+        for (int lane = 0; lane != SUM_EQ_LANES; ++lane)
+        {
+            cutoffs[lane] = get_low_pass_band_frequency(lane, sample_rate);
+        }
+
+        OwnedArray<AnalogFilterBank> filter_banks;
+        IIRFilterBank high_pass_filter_banks[SUM_EQ_LANE_GROUPS];
+        for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
+        {
+            filter_banks.add(new AnalogFilterBank(notifyer));
+            filter_banks[group]->set_fixed_cutoffs(
+                mono_float4::load(cutoffs + group * MONO_SIMD_LANES), sample_rate);
+        }
+        for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+        {
+            filters.add(new AnalogFilter(notifyer));
+
+            const IIRCoefficients coefficients =
+                IIRCoefficients::makeHighPass(sample_rate, get_high_pass_band_frequency(band_id));
+            high_pass_filters[band_id].setCoefficients(coefficients);
+            high_pass_filter_banks[band_id / MONO_SIMD_LANES].set_coefficients(
+                band_id % MONO_SIMD_LANES, coefficients);
+        }
+
+        Random random(1234);
+        bool has_nan = false;
+        double max_error = 0;
+        for (int sid = 0; sid != 200000; ++sid)
+        {
+            const float shape = sid / 10000 % 2 ? 0.5f : float(sid % 10000) / 10000;
+            const float in = random.nextFloat() - 0.5f;
+
+            // EVERY OTHER 20000 SAMPLES THE UPPER BANDS ARE SILENT
+            float lanes[SUM_EQ_LANES] = {0};
+            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+            {
+                const bool is_silent = sid / 20000 % 2 == 1 and band_id > SUM_EQ_BANDS / 2;
+                lanes[band_id] = is_silent ? 0 : in * (0.5f + 0.1f * band_id);
+            }
+
+            float results[SUM_EQ_LANES];
+            for (int group = 0; group != SUM_EQ_LANE_GROUPS; ++group)
+            {
+                AnalogFilterBank &filter_bank = *filter_banks.getUnchecked(group);
+                filter_bank.update_with_fixed_cutoffs(shape * 0.8f);
+                high_pass_filter_banks[group]
+                    .processSingleSampleRaw(filter_bank.processLowResonance(
+                        mono_float4::load(lanes + group * MONO_SIMD_LANES)))
+                    .store(results + group * MONO_SIMD_LANES);
+            }
+            for (int band_id = 0; band_id != SUM_EQ_BANDS; ++band_id)
+            {
+                AnalogFilter &filter = *filters.getUnchecked(band_id);
+                filter.update_with_fixed_cutoff(shape * 0.8f, cutoffs[band_id]);
+                const float expected = high_pass_filters[band_id].processSingleSampleRaw(
+                    filter.processLowResonance(lanes[band_id]));
+                const double error = std::fabs(double(results[band_id]) - expected);
+                has_nan |= std::isnan(error);
+                if (error > max_error)
+                {
+                    max_error = error;
+                }
+            }
+        }
+
+        const bool passed = not has_nan and max_error <= FILTER_BANK_MAX_ERROR;
+        std::cout << String("EQ bands").paddedRight(' ', 36) << " max error "
+                  << (has_nan ? String("nan") : String(max_error, 9)) << " bound "
+                  << String(FILTER_BANK_MAX_ERROR, 9)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+
+    // BURSTS OF NOISE THROUGH A BIG ROOM, BOTH CHANNELS
+    bool check_reverb() noexcept
+    {
+        prepare(44100, 512);
+
+        const float room = 0.9f, wet = 0.7f, width = 0.6f;
+        const float wet_gain = wet * WET_SCALE_FACTOR;
+        const float wet_gain_1 = 0.5f * wet_gain * (1.0f + width);
+        const float wet_gain_2 = 0.5f * wet_gain * (1.0f - width);
+        const float feedback = room * ROOM_SCALE_FACTOR + ROOM_OFFSET;
+
+        bool has_nan = false;
+        double max_error = 0;
+        for (bool left_or_right : {bool(LEFT), bool(RIGHT)})
+        {
+            mono_Reverb reverb(notifyer, left_or_right);
+            ReverbParameters &parameters = reverb.get_parameters();
+            parameters.roomSize = room;
+            parameters.wetLevel = wet;
+            parameters.dryLevel = 1.0f - wet;
+            parameters.width = width;
+            reverb.update_parameters();
+            ReferenceReverb reference(int(sample_rate), left_or_right);
+
+            Random random(1234);
+            for (int sid = 0; sid != int(sample_rate) * 10; ++sid)
+            {
+                const float in = sid % int(sample_rate) < sample_rate / 10
+                                     ? random.nextFloat() - 0.5f
+                                     : 0;
+                const float expected =
+                    reference.process(in, feedback, wet_gain_1, wet_gain_2, 1.0f - wet);
+                const float result = reverb.processSingleSampleRaw(in);
+                const double error = std::fabs(double(result) - expected);
+                has_nan |= std::isnan(error);
+                if (error > max_error)
+                {
+                    max_error = error;
+                }
+            }
+        }
+
+        const bool passed = not has_nan and max_error <= REVERB_MAX_ERROR;
+        std::cout << String("mono_Reverb").paddedRight(' ', 36) << " max error "
+                  << (has_nan ? String("nan") : String(max_error, 9)) << " bound "
+                  << String(REVERB_MAX_ERROR, 9)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+
+    // RANDOM TARGETS, MOTOR TIMES AND BLOCK SIZES, THE BLOCK VERSION AGAINST tick()
+    template <class smoother_type> double check_smoother() noexcept
+    {
+        smoother_type ticked(0.3f), processed(0.3f);
+        Random random(1234);
+        bool has_nan = false;
+        double max_error = 0;
+        for (int block = 0; block != 20000; ++block)
+        {
+            const int num_samples = 1 + random.nextInt(output.get_size() - 1);
+            const float motor_time_in_ms = random.nextInt(4) == 0 ? 0 : random.nextInt(300);
+            ticked.reset_coefficients(44100, motor_time_in_ms);
+            processed.reset_coefficients(44100, motor_time_in_ms);
+            if (random.nextInt(3) == 0)
+            {
+                const float value = random.nextFloat() * 3 - 1.5f;
+                ticked.set_value(value);
+                processed.set_value(value);
+            }
+
+            float *const out = output.getWritePointer(LEFT);
+            processed.process(out, num_samples);
+            for (int sid = 0; sid != num_samples; ++sid)
+            {
+                const double error = std::fabs(double(ticked.tick()) - out[sid]);
+                has_nan |= std::isnan(error);
+                if (error > max_error)
+                {
+                    max_error = error;
+                }
+            }
+            if (ticked.is_up_to_date() != processed.is_up_to_date())
+            {
+                return 1;
+            }
+        }
+
+        return has_nan ? std::numeric_limits<double>::quiet_NaN() : max_error;
+    }
+    bool check_smoothers() noexcept
+    {
+        prepare(44100, 512);
+
+        bool passed = true;
+        for (int min_max = 0; min_max != 2; ++min_max)
+        {
+            const double max_error = min_max ? check_smoother<LinearSmootherMinMax<0, 1>>()
+                                             : check_smoother<LinearSmoother>();
+            const bool smoother_passed = max_error <= SMOOTHER_MAX_ERROR; // FALSE FOR NAN
+            const String name =
+                min_max ? "LinearSmootherMinMax::process" : "LinearSmoother::process";
+            std::cout << name.paddedRight(' ', 36) << " max error " << String(max_error, 9)
+                      << " bound " << String(SMOOTHER_MAX_ERROR, 9)
+                      << (smoother_passed ? "   ok" : "   FAILED") << std::endl;
+            passed &= smoother_passed;
+        }
+
+        return passed;
+    }
+
+    // RAMP i TAKES i % 50 + 1 TICKS AND ENDS EXACTLY ON ITS TARGET, EVERY THIRD ONE IS STOPPED
+    // HALF WAY AND KEEPS ITS LAST VALUE
+    bool check_param_ramps() noexcept
+    {
+        ChangeParamOverTime &scheduler = synth_data->param_change_scheduler.get();
+        OwnedArray<Parameter> params;
+        for (int i = 0; i != PARAM_RAMPS_BENCH_SIZE; ++i)
+        {
+            params.add(new Parameter(0, 1, 0, 1000, "ramp " + String(i), "ramp " + String(i)));
+            ChangeParamOverTime::execute(*params.getLast(), 1,
+                                         (i % 50 + 1) * PARAM_CHANGE_INTERVAL_IN_MS);
+        }
+
+        bool passed = scheduler.get_num_ramps() == PARAM_RAMPS_BENCH_SIZE;
+        Array<float> stopped_values;
+        for (int tick = 1; tick <= 50; ++tick)
+        {
+            if (tick == 25)
+            {
+                for (int i = 0; i < PARAM_RAMPS_BENCH_SIZE; i += 3)
+                {
+                    params[i]->get_runtime_info().stop_time_change();
+                    stopped_values.add(params[i]->get_value());
+                }
+            }
+            scheduler.advance();
+        }
+        passed &= scheduler.get_num_ramps() == 0;
+
+        for (int i = 0; i != PARAM_RAMPS_BENCH_SIZE; ++i)
+        {
+            const float expected_value = i % 3 == 0 ? stopped_values[i / 3] : 1.0f;
+            passed &= params[i]->get_value() == expected_value;
+        }
+
+        std::cout << String("ChangeParamOverTime (" + String(PARAM_RAMPS_BENCH_SIZE) + " ramps)")
+                         .paddedRight(' ', 36)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+
+    // THE SYNC MORPH RUNS IN SAMPLES OF THE RENDER, SO THE SMOOTHERS GET THE SAME TARGETS HALF WAY
+    // AND AT THE END WITH ANY BLOCK SIZE. THE RENDER NEVER TOUCHES THE PARAMS, THEY ARE SET ONCE BY
+    // THE MESSAGE THREAD AFTER THE LAST BLOCK, OR AFTER THE TIMEOUT IF NO BLOCK IS RENDERED. BUILT
+    // WITH MONIQUE_RT_SANITIZER THE RENDER SIDE RUNS IN A REAL TIME SCOPE AND MUST NOT ALLOCATE OR
+    // LOCK.
+    bool check_sync_morph() noexcept
+    {
+        MorphGroup *const morph_groups[SUM_MORPHER_GROUPS] = {
+            synth_data->morph_group_1, synth_data->morph_group_2, synth_data->morph_group_3,
+            synth_data->morph_group_4};
+        Array<Parameter *> &params = synth_data->get_all_parameters();
+
+        // AWAY FROM THE MORPH, WITHOUT TOUCHING THE SOURCES
+        Array<float> start_values;
+        Random random(1234);
+        for (Parameter *param : params)
+        {
+            const ParameterInfo &info = param->get_info();
+            start_values.add(info.min_value +
+                             random.nextFloat() * (info.max_value - info.min_value));
+        }
+
+        const auto add_sync_values = [&](Array<float> &values_) {
+            for (MorphGroup *morph_group : morph_groups)
+            {
+                for (const MorphGroup::SmoothedMorphParameter &param :
+                     morph_group->get_smoothed_params())
+                {
+                    values_.add(morph_group->get_sync_values()[param.index]);
+                    values_.add(morph_group->get_sync_modulations()[param.index]);
+                }
+            }
+        };
+
+        const auto set_start_values = [&]() {
+            for (int i = 0; i != params.size(); ++i)
+            {
+                if (type_of(params[i]) == IS_FLOAT)
+                {
+                    params[i]->set_value_without_notification(start_values[i]);
+                }
+            }
+        };
+
+        bool params_are_untouched = true;
+        bool is_finished = true;
+        const auto run_sync_morph = [&](int block_size_, Array<float> &half_way_values_,
+                                        Array<float> &end_values_, Array<float> &param_values_) {
+            set_start_values();
+            synth_data->run_sync_morph();
+            const int sync_morph_samples = msToSamplesFast(SYNC_MORPH_TIME_IN_MS, 44100);
+            for (int sample = 0; sample < sync_morph_samples + block_size_;
+                 sample += block_size_)
+            {
+                if (sample == SYNC_MORPH_CHECK_HALF_TIME)
+                {
+                    add_sync_values(half_way_values_);
+                }
+
+                MONIQUE_REALTIME_SCOPE;
+                synth_data->morph_snapshot.update();
+                for (MorphGroup *morph_group : morph_groups)
+                {
+                    morph_group->process_sync_morph(synth_data->morph_snapshot.get(),
+                                                    block_size_, 44100);
+                }
+            }
+            add_sync_values(end_values_);
+
+            for (int i = 0; i != params.size(); ++i)
+            {
+                if (type_of(params[i]) == IS_FLOAT)
+                {
+                    params_are_untouched &= params[i]->get_value() == start_values[i];
+                }
+            }
+
+            // THE TIMER OF THE MESSAGE THREAD
+            for (MorphGroup *morph_group : morph_groups)
+            {
+                is_finished &= morph_group->finish_sync_morph();
+            }
+            for (Parameter *param : params)
+            {
+                param_values_.add(param->get_value());
+            }
+        };
+
+#if MONIQUE_RT_SANITIZER
+        const int num_violations_before = get_num_realtime_violations();
+#endif
+        Array<float> half_way_values_1, end_values_1, param_values_1;
+        Array<float> half_way_values_2, end_values_2, param_values_2;
+        run_sync_morph(SYNC_MORPH_CHECK_BLOCK_SIZE_1, half_way_values_1, end_values_1,
+                       param_values_1);
+        run_sync_morph(SYNC_MORPH_CHECK_BLOCK_SIZE_2, half_way_values_2, end_values_2,
+                       param_values_2);
+
+        // NO BLOCK AT ALL, THE TIMER SETS THE SAME PARAMS ONLY AFTER THE TIMEOUT
+        set_start_values();
+        synth_data->run_sync_morph();
+        const uint32 now_ms = Time::getMillisecondCounter();
+        bool is_stall_finished = true;
+        for (MorphGroup *morph_group : morph_groups)
+        {
+            is_stall_finished &= not morph_group->finish_sync_morph();
+            is_stall_finished &= not morph_group->finish_stalled_sync_morph(now_ms);
+            is_stall_finished &=
+                morph_group->finish_stalled_sync_morph(now_ms + SYNC_MORPH_TIMEOUT_IN_MS);
+        }
+        for (int i = 0; is_stall_finished and i != params.size(); ++i)
+        {
+            is_stall_finished &= params[i]->get_value() == param_values_1[i];
+        }
+
+        bool is_moving = false;
+        bool passed = params_are_untouched and is_finished and half_way_values_1.size() > 0 and
+                      half_way_values_1.size() == half_way_values_2.size();
+        for (int i = 0; passed and i != half_way_values_1.size(); ++i)
+        {
+            passed &= half_way_values_1[i] == half_way_values_2[i];
+            passed &= end_values_1[i] == end_values_2[i];
+            is_moving |= half_way_values_1[i] != end_values_1[i];
+        }
+        for (int i = 0; passed and i != params.size(); ++i)
+        {
+            passed &= param_values_1[i] == param_values_2[i];
+        }
+        passed &= is_moving and is_stall_finished;
+#if MONIQUE_RT_SANITIZER
+        passed &= get_num_realtime_violations() == num_violations_before;
+#endif
+
+        std::cout << String("MorphGroup::process_sync_morph").paddedRight(' ', 36)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+
+    // ONE SECOND OF NOISE, THEN SILENCE UNTIL THE FEEDBACK STATES WOULD BE DENORMAL. THE LAST
+    // SECOND OF THE TAIL MUST NOT BE SLOWER THAN THE NOISE.
+    template <class process_sample_type>
+    bool check_silence_tail(const char *name_, process_sample_type &&process_sample_) noexcept
+    {
+        Random random(1234);
+        const auto run_second = [&](bool is_silent_) {
+            const int64 start = Time::getHighResolutionTicks();
+            for (int sid = 0; sid != int(sample_rate); ++sid)
+            {
+                const float noise = random.nextFloat() - 0.5f;
+                bench_sink = process_sample_(is_silent_ ? 0 : noise);
+            }
+            return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+        };
+
+        const double noise_seconds = run_second(false);
+        double tail_seconds = 0;
+        for (int second = 0; second != SILENCE_TAIL_SECONDS; ++second)
+        {
+            tail_seconds = run_second(true);
+        }
+
+        const double slowdown = tail_seconds / noise_seconds;
+        const bool passed = slowdown <= SILENCE_TAIL_MAX_SLOWDOWN;
+        std::cout << String(name_).paddedRight(' ', 36) << " tail slowdown "
+                  << String(slowdown, 3) << " bound " << String(SILENCE_TAIL_MAX_SLOWDOWN, 3)
+                  << (passed ? "   ok" : "   FAILED") << std::endl;
+
+        return passed;
+    }
+    bool check_silence_tails() noexcept
+    {
+        prepare(44100, 512);
+
+        bool passed = true;
+        {
+            AnalogFilter filter(notifyer);
+            filter.update_with_fixed_cutoff(0.9f, 1000);
+            passed &= check_silence_tail("AnalogFilter (silence tail)", [&](float in_) {
+                return filter.processLowResonance(in_);
+            });
+        }
+        {
+            AnalogFilterBank filter_bank(notifyer);
+            filter_bank.set_fixed_cutoffs(mono_float4::broadcast(1000), sample_rate);
+            filter_bank.update_with_fixed_cutoffs(0.9f);
+            passed &= check_silence_tail("AnalogFilterBank (silence tail)", [&](float in_) {
+                return filter_bank.processLowResonance(mono_float4::broadcast(in_)).get(0);
+            });
+        }
+        {
+            // THE SMALLEST ROOM DECAYS FASTEST INTO THE DENORMAL RANGE
+            mono_Reverb reverb(notifyer, LEFT);
+            ReverbParameters &parameters = reverb.get_parameters();
+            parameters.roomSize = 0;
+            parameters.dryLevel = 0.5f;
+            parameters.wetLevel = 0.5f;
+            parameters.width = 0.5f;
+            reverb.update_parameters();
+            passed &= check_silence_tail("mono_Reverb (silence tail)", [&](float in_) {
+                return reverb.processSingleSampleRaw(in_);
+            });
+        }
+
+        return passed;
+    }
+
+    //==========================================================================
+    void run_all() noexcept
+    {
+        if (as_csv)
+        {
+            std::cout << "kernel,sample_rate,block_size,ns_per_sample" << std::endl;
+        }
+
+        for (double sample_rate_ : bench_sample_rates)
+        {
+            for (int block_size_ : bench_block_sizes)
+            {
+                prepare(sample_rate_, block_size_);
+
+                run_oscillators();
+                run_envelopes();
+                run_filters();
+                run_eq();
+                run_effects();
+                run_modulators();
+                run_smoothers();
+                run_shapers();
+            }
+        }
+
+        run_param_ramps();
+    }
+
+    //==========================================================================
+    KernelBench(MoniqueAudioProcessor *processor_, const BenchConfig &config_,
+                const String &only_kernel_, bool as_csv_) noexcept
+        : audio_processor(*processor_), synth_data(processor_->synth_data),
+          notifyer(processor_->runtime_notifyer), config(config_), only_kernel(only_kernel_),
+          as_csv(as_csv_), sample_rate(44100), block_size(512), input(block_size),
+          output(block_size), controls(block_size)
+    {
+    }
+    ~KernelBench() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(KernelBench)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    ArgumentList args(argc, argv);
+    const bool only_check = args.containsOption("--check");
+
+    BenchConfig config;
+    config.seconds_to_run = args.containsOption("--seconds")
+                                ? args.getValueForOption("--seconds").getDoubleValue()
+                                : 2.0;
+    config.repeats =
+        args.containsOption("--repeats") ? args.getValueForOption("--repeats").getIntValue() : 5;
+    if (config.seconds_to_run <= 0 or config.repeats <= 0)
+    {
+        std::cout << "usage: monique-kernel-bench [--seconds 2] [--repeats 5] [--kernel <name>] "
+                     "[--csv]"
+                  << std::endl;
+        return 1;
+    }
+
+    // THE LOOK AND FEEL AND THE PARAMETER TIMERS NEED A MESSAGE MANAGER
+    ScopedJuceInitialiser_GUI juce_initialiser;
+    const ScopedNoDenormals no_denormals;
+
+    std::unique_ptr<AudioProcessor> owned_processor = create_headless_processor();
+    MoniqueAudioProcessor *processor = dynamic_cast<MoniqueAudioProcessor *>(owned_processor.get());
+
+    {
+        KernelBench bench(processor, config,
+                          args.containsOption("--kernel") ? args.getValueForOption("--kernel")
+                                                          : String(),
+                          args.containsOption("--csv"));
+        if (only_check)
+        {
+            const bool shapers_passed = check_shapers();
+            const bool filter_bank_passed = bench.check_filter_bank();
+            const bool eq_bands_passed = bench.check_eq_bands();
+            const bool reverb_passed = bench.check_reverb();
+            const bool smoothers_passed = bench.check_smoothers();
+            const bool silence_tails_passed = bench.check_silence_tails();
+            const bool parameter_snapshot_passed = check_parameter_snapshot();
+            const bool param_ramps_passed = bench.check_param_ramps();
+            const bool sync_morph_passed = bench.check_sync_morph();
+            return (shapers_passed and filter_bank_passed and eq_bands_passed and reverb_passed and
+                    smoothers_passed and silence_tails_passed and parameter_snapshot_passed and
+                    param_ramps_passed and sync_morph_passed)
+                       ? 0
+                       : 1;
+        }
+
+        bench.run_all();
+    }
+
+    return 0;
+}
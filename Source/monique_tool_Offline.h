@@ -0,0 +1,89 @@
+#ifndef MONIQUE_TOOL_OFFLINE_H_INCLUDED
+#define MONIQUE_TOOL_OFFLINE_H_INCLUDED
+
+#include "monique_core_Processor.h"
+
+#include "monique_core_Datastructures.h"
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// SHARED HELPERS OF THE HEADLESS TOOLS (RENDER AND BENCHMARKS)
+//==============================================================================
+AudioProcessor *JUCE_CALLTYPE createPluginFilter();
+
+//==============================================================================
+// THE PLUGIN PATH ONLY RENDERS WITH AN ATTACHED PLAY HEAD
+class OfflinePlayHead : public AudioPlayHead
+{
+    const double sample_rate;
+    const double bpm;
+    int64 samples_since_start;
+
+  public:
+    //==========================================================================
+    bool getCurrentPosition(CurrentPositionInfo &result_) override
+    {
+        result_.resetToDefault();
+
+        result_.bpm = bpm;
+        result_.timeSigNumerator = 4;
+        result_.timeSigDenominator = 4;
+        result_.timeInSamples = samples_since_start;
+        result_.timeInSeconds = samples_since_start / sample_rate;
+        result_.ppqPosition = result_.timeInSeconds * (bpm / 60);
+        result_.ppqPositionOfLastBarStart = std::floor(result_.ppqPosition / 4) * 4;
+        result_.isPlaying = true;
+        result_.isRecording = false;
+        result_.isLooping = false;
+
+        return true;
+    }
+    void advance(int num_samples_) noexcept { samples_since_start += num_samples_; }
+    void rewind() noexcept { samples_since_start = 0; }
+
+    //==========================================================================
+    OfflinePlayHead(double sample_rate_, double bpm_) noexcept
+        : sample_rate(sample_rate_), bpm(bpm_), samples_since_start(0)
+    {
+    }
+    ~OfflinePlayHead() noexcept {}
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OfflinePlayHead)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+static inline bool load_program(MoniqueAudioProcessor &processor_, const XmlElement *xml_,
+                                const String &name_) noexcept
+{
+    if (xml_)
+    {
+        if (xml_->hasTagName("PROJECT-1.0") || xml_->hasTagName("MONOLisa"))
+        {
+            processor_.synth_data->read_from(xml_);
+            processor_.synth_data->alternative_program_name = name_;
+            return true;
+        }
+    }
+
+    return false;
+}
+static inline bool load_program(MoniqueAudioProcessor &processor_,
+                                const File &program_file_) noexcept
+{
+    std::unique_ptr<XmlElement> xml = XmlDocument(program_file_).getDocumentElement();
+    return load_program(processor_, xml.get(), program_file_.getFileNameWithoutExtension());
+}
+
+//==============================================================================
+// NOTE: THE DTOR OF THE PROCESSOR IS PROTECTED, SO WE OWN IT AS AN AudioProcessor
+static inline std::unique_ptr<AudioProcessor> create_headless_processor() noexcept
+{
+    std::unique_ptr<AudioProcessor> processor(createPluginFilter());
+    jassert(dynamic_cast<MoniqueAudioProcessor *>(processor.get()));
+    return processor;
+}
+
+#endif // MONIQUE_TOOL_OFFLINE_H_INCLUDED
@@ -0,0 +1,349 @@
+#include "monique_tool_Offline.h"
+
+#include "monique_core_Synth.h"
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+// REAL TIME FACTOR BENCHMARK
+//
+// monique-rtf-bench [--sample-rate 44100] [--block-size 512] [--bars 8] [--program <filter>]
+//                   [--workers 3] [--control-rate 1] [--cubic] [--csv]
+//
+// PLAYS A FIXED NOTE PATTERN AND A FIXED ARP PATTERN THROUGH EVERY PROGRAM OF THE EMBEDDED
+// A.zip BANK AND THE FACTORY DEFAULT. REPORTS THE REAL TIME FACTOR (RENDER TIME / AUDIO TIME)
+// AND THE CPU TIME PER BLOCK.
+//==============================================================================
+#define RTF_BENCH_BPM 120
+
+//==============================================================================
+// 1/8 NOTES WITH SOME OVERLAPPING (LEGATO) STEPS AND VELOCITY CHANGES
+static void create_note_pattern(MidiMessageSequence &sequence_, int bars_) noexcept
+{
+    static const int notes[] = {36, 43, 48, 51, 55, 48, 43, 39};
+    static const float velocities[] = {1.0f, 0.6f, 0.8f, 0.5f, 0.9f, 0.6f, 0.7f, 0.4f};
+    const double seconds_per_eighth = 60.0 / RTF_BENCH_BPM / 2;
+
+    for (int bar = 0; bar != bars_; ++bar)
+    {
+        for (int step = 0; step != 8; ++step)
+        {
+            const double start = (bar * 8 + step) * seconds_per_eighth;
+            const bool is_legato = step % 4 == 3;
+            const double length = seconds_per_eighth * (is_legato ? 1.25 : 0.75);
+            const int note = notes[step] + (bar % 2) * 12;
+            sequence_.addEvent(MidiMessage::noteOn(1, note, velocities[step]), start);
+            sequence_.addEvent(MidiMessage::noteOff(1, note), start + length);
+        }
+    }
+    sequence_.sort();
+    sequence_.updateMatchedPairs();
+}
+// ONE HELD NOTE PER BAR, THE ARP OF THE PROGRAM DOES THE REST
+static void create_arp_pattern(MidiMessageSequence &sequence_, int bars_) noexcept
+{
+    static const int notes[] = {48, 43, 46, 41};
+    const double seconds_per_bar = 60.0 / RTF_BENCH_BPM * 4;
+
+    for (int bar = 0; bar != bars_; ++bar)
+    {
+        const double start = bar * seconds_per_bar;
+        const int note = notes[bar % 4];
+        sequence_.addEvent(MidiMessage::noteOn(1, note, 0.8f), start);
+        sequence_.addEvent(MidiMessage::noteOff(1, note), start + seconds_per_bar * 0.95);
+    }
+    sequence_.sort();
+    sequence_.updateMatchedPairs();
+}
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+struct RenderStats
+{
+    double audio_seconds = 0;
+    double render_seconds = 0;
+    Array<double> block_micro_seconds;
+
+    double rtf() const noexcept { return render_seconds / jmax(1.0e-9, audio_seconds); }
+    double mean() const noexcept
+    {
+        double sum = 0;
+        for (double value : block_micro_seconds)
+        {
+            sum += value;
+        }
+        return sum / jmax(1, block_micro_seconds.size());
+    }
+    double percentile(double percent_) const noexcept
+    {
+        if (block_micro_seconds.size() == 0)
+        {
+            return 0;
+        }
+
+        Array<double> sorted(block_micro_seconds);
+        sorted.sort();
+        const int index = jlimit(0, sorted.size() - 1, int(sorted.size() * percent_ / 100));
+        return sorted.getUnchecked(index);
+    }
+};
+
+//==============================================================================
+class RealtimeBench
+{
+    AudioProcessor &audio_processor;
+    MoniqueAudioProcessor &processor;
+
+    const double sample_rate;
+    const int block_size;
+    const int bars;
+    const bool as_csv;
+
+    OfflinePlayHead play_head;
+    AudioSampleBuffer buffer;
+    MidiBuffer midi_messages;
+
+    MidiMessageSequence note_pattern;
+    MidiMessageSequence arp_pattern;
+
+    RenderStats total;
+    String worst_name;
+    double worst_rtf;
+
+    //==========================================================================
+    RenderStats render(const MidiMessageSequence &sequence_) noexcept
+    {
+        processor.reset_pending_notes();
+        play_head.rewind();
+        audio_processor.prepareToPlay(sample_rate, block_size);
+
+        RenderStats stats;
+        const int64 length_in_samples = int64((sequence_.getEndTime() + 1) * sample_rate);
+        stats.audio_seconds = length_in_samples / sample_rate;
+        stats.block_micro_seconds.ensureStorageAllocated(int(length_in_samples / block_size) + 1);
+
+        int event_index = 0;
+        const int num_events = sequence_.getNumEvents();
+        for (int64 block_start = 0; block_start < length_in_samples; block_start += block_size)
+        {
+            const int64 block_end = block_start + block_size;
+
+            midi_messages.clear();
+            while (event_index < num_events)
+            {
+                const MidiMessage &message = sequence_.getEventPointer(event_index)->message;
+                const int64 event_sample = int64(message.getTimeStamp() * sample_rate);
+                if (event_sample >= block_end)
+                {
+                    break;
+                }
+
+                midi_messages.addEvent(message, int(jmax(int64(0), event_sample - block_start)));
+                ++event_index;
+            }
+
+            const int64 start = Time::getHighResolutionTicks();
+            audio_processor.processBlock(buffer, midi_messages);
+            const double seconds =
+                Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+
+            stats.render_seconds += seconds;
+            stats.block_micro_seconds.add(seconds * 1.0e6);
+            play_head.advance(block_size);
+        }
+
+        return stats;
+    }
+
+    //==========================================================================
+    void report(const String &name_, const char *pattern_, const RenderStats &stats_) noexcept
+    {
+        const double budget_micro_seconds = 1.0e6 * block_size / sample_rate;
+        if (as_csv)
+        {
+            std::cout << "\"" << name_ << "\"," << pattern_ << "," << stats_.rtf() << ","
+                      << stats_.mean() << "," << stats_.percentile(99) << ","
+                      << stats_.percentile(100) << "," << budget_micro_seconds << std::endl;
+        }
+        else
+        {
+            std::cout << name_.substring(0, 32).paddedRight(' ', 34)
+                      << String(pattern_).paddedRight(' ', 6) << " rtf " << String(stats_.rtf(), 4)
+                      << "   us/block mean " << String(stats_.mean(), 1) << " p99 "
+                      << String(stats_.percentile(99), 1)
+                      << " max " << String(stats_.percentile(100), 1) << " (budget "
+                      << String(budget_micro_seconds, 1) << ")" << std::endl;
+        }
+
+        total.audio_seconds += stats_.audio_seconds;
+        total.render_seconds += stats_.render_seconds;
+        total.block_micro_seconds.addArray(stats_.block_micro_seconds);
+        if (stats_.rtf() > worst_rtf)
+        {
+            worst_rtf = stats_.rtf();
+            worst_name = name_ + " (" + pattern_ + ")";
+        }
+    }
+
+  public:
+    //==========================================================================
+    void run_current_program(const String &name_) noexcept
+    {
+        BoolParameter &arp_is_on = processor.synth_data->arp_sequencer_data->is_on;
+        const bool arp_was_on = arp_is_on;
+
+        arp_is_on = false;
+        report(name_, "notes", render(note_pattern));
+
+        arp_is_on = true;
+        report(name_, "arp", render(arp_pattern));
+
+        arp_is_on = arp_was_on;
+    }
+
+    void print_summary() const noexcept
+    {
+        if (as_csv)
+        {
+            return;
+        }
+
+        std::cout << std::endl
+                  << "TOTAL rtf " << String(total.rtf(), 4) << "   us/block mean "
+                  << String(total.mean(), 1) << " p99 " << String(total.percentile(99), 1)
+                  << " max " << String(total.percentile(100), 1) << std::endl
+                  << "WORST " << worst_name << " rtf " << String(worst_rtf, 4) << std::endl;
+    }
+
+    //==========================================================================
+    RealtimeBench(AudioProcessor &audio_processor_, double sample_rate_, int block_size_,
+                  int bars_, bool as_csv_) noexcept
+        : audio_processor(audio_processor_),
+          processor(*dynamic_cast<MoniqueAudioProcessor *>(&audio_processor_)),
+          sample_rate(sample_rate_), block_size(block_size_), bars(bars_), as_csv(as_csv_),
+          play_head(sample_rate_, RTF_BENCH_BPM),
+          buffer(jmax(2, audio_processor_.getTotalNumOutputChannels()), block_size_),
+          worst_rtf(0)
+    {
+        create_note_pattern(note_pattern, bars);
+        create_arp_pattern(arp_pattern, bars);
+
+        audio_processor.setPlayHead(&play_head);
+        audio_processor.setNonRealtime(false);
+        audio_processor.setRateAndBufferSizeDetails(sample_rate, block_size);
+
+        midi_messages.ensureSize(2048);
+
+        if (as_csv)
+        {
+            std::cout << "program,pattern,rtf,us_per_block_mean,us_per_block_p99,us_per_block_max,"
+                         "us_per_block_budget"
+                      << std::endl;
+        }
+    }
+    ~RealtimeBench() noexcept
+    {
+        audio_processor.releaseResources();
+        audio_processor.setPlayHead(nullptr);
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeBench)
+};
+
+//==============================================================================
+//==============================================================================
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    ArgumentList args(argc, argv);
+    const double sample_rate = args.containsOption("--sample-rate")
+                                   ? args.getValueForOption("--sample-rate").getDoubleValue()
+                                   : 44100;
+    const int block_size = args.containsOption("--block-size")
+                               ? args.getValueForOption("--block-size").getIntValue()
+                               : 512;
+    const int bars =
+        args.containsOption("--bars") ? args.getValueForOption("--bars").getIntValue() : 8;
+    const String program_filter =
+        args.containsOption("--program") ? args.getValueForOption("--program") : String();
+    const int num_workers = args.containsOption("--workers")
+                                ? args.getValueForOption("--workers").getIntValue()
+                                : MONIQUE_NUM_WORKER_THREADS;
+    const int control_rate = args.containsOption("--control-rate")
+                                 ? args.getValueForOption("--control-rate").getIntValue()
+                                 : 1;
+    if (sample_rate <= 0 or block_size <= 0 or bars <= 0 or num_workers < 0 or
+        control_rate < 1 or control_rate > MONIQUE_MAX_CONTROL_RATE)
+    {
+        std::cout << "usage: monique-rtf-bench [--sample-rate 44100] [--block-size 512] "
+                     "[--bars 8] [--program <filter>] [--workers 3] [--control-rate 1] "
+                     "[--cubic] [--csv]"
+                  << std::endl;
+        return 1;
+    }
+
+    // THE LOOK AND FEEL AND THE PARAMETER TIMERS NEED A MESSAGE MANAGER
+    ScopedJuceInitialiser_GUI juce_initialiser;
+
+    std::unique_ptr<AudioProcessor> owned_processor = create_headless_processor();
+    MoniqueAudioProcessor *processor = dynamic_cast<MoniqueAudioProcessor *>(owned_processor.get());
+    processor->synth->set_num_worker_threads(num_workers);
+    processor->synth->set_control_rate(control_rate, args.containsOption("--cubic"));
+    if (not args.containsOption("--csv"))
+    {
+        std::cout << "WORKER THREADS " << processor->synth->get_num_worker_threads() << std::endl;
+        std::cout << "CONTROL RATE " << processor->synth->get_control_rate()
+                  << (processor->synth->is_control_rate_cubic() ? " CUBIC" : " LINEAR")
+                  << std::endl;
+    }
+
+    {
+        RealtimeBench bench(*owned_processor, sample_rate, block_size, bars,
+                            args.containsOption("--csv"));
+
+        // FACTORY DEFAULT
+        if (program_filter.isEmpty() or String(FACTORY_NAME).containsIgnoreCase(program_filter))
+        {
+            processor->synth_data->load_default();
+            bench.run_current_program(FACTORY_NAME);
+        }
+
+        // EMBEDDED BANK
+        ZipFile bank(new MemoryInputStream(BinaryData::A_zip, BinaryData::A_zipSize, false), true);
+        for (int i = 0; i != bank.getNumEntries(); ++i)
+        {
+            const String file_name = bank.getEntry(i)->filename;
+            if (not file_name.endsWithIgnoreCase(".mlprog"))
+            {
+                continue;
+            }
+            const String name =
+                file_name.fromLastOccurrenceOf("/", false, false).upToLastOccurrenceOf(".", false,
+                                                                                        false);
+            if (program_filter.isNotEmpty() and not file_name.containsIgnoreCase(program_filter))
+            {
+                continue;
+            }
+
+            std::unique_ptr<InputStream> stream(bank.createStreamForEntry(i));
+            if (not stream)
+            {
+                continue;
+            }
+            std::unique_ptr<XmlElement> xml =
+                XmlDocument::parse(stream->readEntireStreamAsString());
+            if (not load_program(*processor, xml.get(), name))
+            {
+                std::cerr << "MONIQUE: can not load program " << file_name << std::endl;
+                continue;
+            }
+
+            bench.run_current_program(file_name.upToLastOccurrenceOf(".", false, false));
+        }
+
+        bench.print_summary();
+    }
+
+    return 0;
+}
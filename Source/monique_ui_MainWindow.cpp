@@ -120,6 +120,7 @@ void Monique_Ui_Mainwindow::refresh() noexcept
     resize_sequence_buttons();
     show_programs_and_select(false);
     show_ctrl_state();
+    audio_processor->show_midi_input_on_keyboard();
 }
 void Monique_Ui_Mainwindow::update_tooltip_handling(bool is_help_key_down_) noexcept
 {
@@ -2162,8 +2163,9 @@ Monique_Ui_Mainwindow::Monique_Ui_Mainwindow(Monique_Ui_Refresher *ui_refresher_
                           new Monique_Ui_DualSlider(ui_refresher, new WAVESlConfig(synth_data, 2)));
 
     addAndMakeVisible(
-        keyboard = new MidiKeyboardComponent(*reinterpret_cast<MoniqueAudioProcessor *>(&processor),
-                                             MidiKeyboardComponent::horizontalKeyboard));
+        keyboard = new MidiKeyboardComponent(
+            reinterpret_cast<MoniqueAudioProcessor *>(&processor)->ui_keyboard_state,
+            MidiKeyboardComponent::horizontalKeyboard));
 
     addAndMakeVisible(glide2 =
                           new Monique_Ui_DualSlider(ui_refresher, new GlideConfig(synth_data)));
@@ -5794,8 +5796,8 @@ void Monique_Ui_Mainwindow::buttonClicked(Button *buttonThatWasClicked)
         synth_data->keep_arp_always_off = false;
         audio_processor->reset_pending_notes();
 
-        audio_processor->noteOn(1, 60 + synth_data->note_offset.get_value() - 24, 1.0f);
-        audio_processor->noteOff(1, 60 + synth_data->note_offset.get_value() - 24, 0);
+        audio_processor->ui_note_on(1, 60 + synth_data->note_offset.get_value() - 24, 1.0f);
+        audio_processor->ui_note_off(1, 60 + synth_data->note_offset.get_value() - 24);
 
         button_flasher = new ButtonFlasher(this, buttonThatWasClicked, true, 1);
         //[/UserButtonCode_button_reset_arp_tune]
@@ -7629,7 +7631,7 @@ BEGIN_JUCER_METADATA
                     params="ui_refresher, &#10;new WAVESlConfig(synth_data,2)"/>
   <GENERICCOMPONENT name="" id="a8343a0b5df2dc06" memberName="keyboard" virtualName="MidiKeyboardComponent"
                     explicitFocusOrder="0" pos="0 1030 1465 180" class="Component"
-                    params="*reinterpret_cast&lt; MoniqueAudioProcessor* &gt;( &amp;processor ), MidiKeyboardComponent::horizontalKeyboard"/>
+                    params="reinterpret_cast&lt; MoniqueAudioProcessor* &gt;( &amp;processor )-&gt;ui_keyboard_state, MidiKeyboardComponent::horizontalKeyboard"/>
   <GENERICCOMPONENT name="" id="35003b6b21577713" memberName="glide2" virtualName=""
                     explicitFocusOrder="0" pos="100 860 60 130" class="Monique_Ui_DualSlider"
                     params="ui_refresher, &#10;new GlideConfig(synth_data)"/>
@@ -0,0 +1,88 @@
+# Headless command line tools.
+#
+# This cmake file introduces a helper to build console executables which run the Monique engine
+# without a host, a plugin wrapper or an editor:
+#  monique_add_headless_tool(<target> SOURCES <sources...> [EXCLUDE_SOURCES <sources...>])
+#
+# The tools compile the same engine sources as the plugin (MONIQUE_SOURCES) into their own
+# binary. Linking against the shared code target of the plugin is not possible because the JUCE
+# modules are compiled into it privately.
+#
+# EXCLUDE_SOURCES removes engine sources, e.g. for tools which include monique_core_Synth.cpp
+# directly to reach the DSP classes defined there.
+#
+# MONIQUE_RT_SANITIZER is only compiled into the tools. It replaces malloc, free and
+# pthread_mutex_lock of the whole process, which a plugin must never do to its host.
+
+function(monique_add_headless_tool target)
+    cmake_parse_arguments(TOOL "" "" "SOURCES;EXCLUDE_SOURCES" ${ARGN})
+
+    set(engine_sources ${MONIQUE_SOURCES})
+    if(TOOL_EXCLUDE_SOURCES)
+        list(REMOVE_ITEM engine_sources ${TOOL_EXCLUDE_SOURCES})
+    endif()
+
+    juce_add_console_app(${target} PRODUCT_NAME ${target})
+    juce_generate_juce_header(${target})
+
+    target_sources(${target} PRIVATE ${TOOL_SOURCES} ${engine_sources} ${CMAKE_BINARY_DIR}/geninclude/version.cpp)
+    if(MONIQUE_RT_SANITIZER)
+        target_sources(${target} PRIVATE ${CMAKE_SOURCE_DIR}/Source/monique_core_RealtimeSanitizer.cpp)
+        target_compile_definitions(${target} PRIVATE MONIQUE_RT_SANITIZER=1)
+    endif()
+    target_include_directories(${target} PRIVATE ${CMAKE_SOURCE_DIR}/Source)
+
+    target_compile_definitions(${target}
+      PRIVATE
+            JucePlugin_Name="Monique"
+            JUCE_USE_CURL=0
+            JUCE_WEB_BROWSER=0
+            JUCE_DISPLAY_SPLASH_SCREEN=0
+            IS_STANDALONE_WITH_OWN_AUDIO_MANAGER_AND_MIDI_HANDLING=0
+            ${MONIQUE_ENGINE_DEFINITIONS}
+    )
+
+    target_link_libraries(${target}
+      PRIVATE
+        MoniqueMonosynth_BinaryData
+        juce::juce_audio_formats
+        juce::juce_audio_processors
+        juce::juce_audio_utils
+        juce::juce_core
+        juce::juce_graphics
+        juce::juce_gui_basics
+        juce::juce_gui_extra
+        juce::juce_recommended_config_flags
+        juce::juce_recommended_lto_flags
+
+        monique::oddsound-mts
+    )
+
+    if(UNIX)
+        target_compile_options(${target} PRIVATE
+                -Wno-deprecated-declarations
+                -Wno-float-conversion
+                -Wno-sign-conversion
+                -Wno-unused-value
+                -Wno-return-type
+                -Wno-literal-conversion
+                -Wno-shadow
+                $<$<CXX_COMPILER_ID:GNU>:-Wno-enum-compare>
+                )
+    else()
+        target_compile_options(${target} PRIVATE
+                /wd4804 /wd4805 /wd4715 /wd4996 /wd4099 /wd4244 /wd4305
+                /permissive-
+                )
+    endif()
+
+    # SYMBOL NAMES IN THE STACK TRACES OF THE RT SANITIZER
+    if(MONIQUE_RT_SANITIZER AND UNIX AND NOT APPLE)
+        target_link_options(${target} PRIVATE -rdynamic)
+        target_link_libraries(${target} PRIVATE ${CMAKE_DL_LIBS})
+    endif()
+
+    if(TARGET version-info)
+        add_dependencies(${target} version-info)
+    endif()
+endfunction()